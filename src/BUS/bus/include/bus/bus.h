@@ -1,9 +1,11 @@
 #pragma once
+#include <bus/unmapped_access_log.h>
 #include <cstdint>
 #include <ibusdevice.h>
 #include <memory>
 #include <memoryinterface.h>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace DataExchange {
@@ -30,10 +32,64 @@ public:
     Bus &operator=(Bus &&) = default;
     ~Bus() override = default;
 
+    /// 24-bit address space of the m68k covered by the page tables
+    static constexpr uint32_t PAGE_TABLE_ADDRESS_SPACE = 0x1000000;
+    /// 4 KB pages: fine enough for Genesis I/O and Z80 windows, small enough to keep tables cheap
+    static constexpr uint32_t PAGE_SHIFT = 12;
+    static constexpr uint32_t PAGE_SIZE = 1U << PAGE_SHIFT;
+    static constexpr uint32_t PAGES_COUNT = PAGE_TABLE_ADDRESS_SPACE >> PAGE_SHIFT;
+
     [[nodiscard]] std::expected<MemoryAccessResult, MemoryAccessError> read16(uint32_t address) const override;
     [[nodiscard]] std::expected<void, MemoryAccessError> write16(uint32_t address, uint16_t value) override;
+    [[nodiscard]] std::expected<MemoryAccessResult8, MemoryAccessError> read8(uint32_t address) const override;
+    [[nodiscard]] std::expected<void, MemoryAccessError> write8(uint32_t address, uint8_t value) override;
+    [[nodiscard]] std::expected<MemoryAccessResult32, MemoryAccessError> read32(uint32_t address) const override;
+    [[nodiscard]] std::expected<void, MemoryAccessError> write32(uint32_t address, uint32_t value) override;
     bool mapDevice(DeviceParams deviceParams);
 
+    /**
+     * @brief ROM pages (readable, not writable) are READ_ONLY, fully direct RAM pages are WRITABLE,
+     *        everything else (I/O, shared pages, unmapped) is UNCACHEABLE.
+     */
+    [[nodiscard]] CodeMemoryType codeMemoryType(uint32_t address) const override;
+
+    /**
+     * @brief Copies from direct pages only, stopping at the end of the page containing address.
+     */
+    [[nodiscard]] size_t peekCodeWords(uint32_t address, std::span<uint16_t> words) const override;
+
+    /**
+     * @brief Direct pages only: ROM or RAM to RAM. Watched code pages written to are reported.
+     */
+    [[nodiscard]] bool copyMemory(uint32_t destination, uint32_t source, uint32_t length) override;
+
+    /**
+     * @brief Direct RAM pages only. Watched code pages written to are reported.
+     */
+    [[nodiscard]] bool fillMemory(uint32_t destination, uint32_t length, std::span<const uint8_t> pattern) override;
+
+    /**
+     * @brief Direct pages never have read side effects, device pages ask the device,
+     *        unmapped addresses do (a bus error).
+     */
+    [[nodiscard]] bool readHasSideEffects(uint32_t address) const override;
+    void watchCodeWrites(uint32_t address) override;
+    void addCodeWriteListener(CodeWriteListener* listener) override;
+    void removeCodeWriteListener(CodeWriteListener* listener) override;
+
+    /**
+     * @brief Accesses that hit no device, recorded without formatting in the access path.
+     */
+    [[nodiscard]] UnmappedAccessLog& unmappedAccessLog() const;
+
+    /**
+     * @brief Drain unmapped accesses recorded so far and log them via spdlog.
+     * @return Number of logged accesses.
+     *
+     * Intended to be called outside the instruction loop, e.g. once per frame.
+     */
+    size_t logUnmappedAccesses() const; //NOLINT(*-use-nodiscard)
+
 private:
 
     enum class OperationType : uint8_t {
@@ -46,7 +102,38 @@ private:
         uint32_t addressOffset = 0;
     };
 
+    /**
+     * @brief Page table entry for one PAGE_SIZE page of the address space.
+     *
+     * A page fully covered by a single device resolves with one index: device
+     * pointer plus the device base address. If the device also exposes backing
+     * storage covering the whole page, the page is direct: memory points to that
+     * storage and accesses never reach the device. A page only partly covered by
+     * one or more devices is marked shared and resolved by scanning devices_.
+     */
+    template <typename ByteType>
+    struct PageEntry {
+        IBusDevice* device = nullptr;
+        ByteType* memory = nullptr;
+        uint32_t baseAddress = 0;
+        bool shared = false;
+    };
+
+    template <typename ByteType>
+    using PageTable = std::vector<PageEntry<ByteType>>;
+
     [[nodiscard]] std::optional<DeviceMatcher> findDevice(OperationType operationType, uint32_t address) const;
+    template <typename ByteType>
+    [[nodiscard]] std::optional<DeviceMatcher> findDeviceInPages(const PageTable<ByteType>& pageTable, OperationType operationType, uint32_t address) const;
+    [[nodiscard]] std::optional<DeviceMatcher> scanDevices(OperationType operationType, uint32_t address) const;
+    template <typename ByteType>
+    void fillPageTable(PageTable<ByteType>& pageTable, const DeviceParams& deviceParams, const AddressRange& range, std::span<ByteType> memory);
+    void checkCodeWrite(uint32_t address);
+    template <typename ByteType>
+    [[nodiscard]] static bool isDirectRange(const PageTable<ByteType>& pageTable, uint32_t address, uint32_t length);
+    template <typename ByteType>
+    [[nodiscard]] static ByteType* directPointer(const PageTable<ByteType>& pageTable, uint32_t address);
+    [[nodiscard]] static bool isLongInsidePage(uint32_t address);
     [[nodiscard]] bool isAddressInRange(uint32_t address, const AddressRange& range) const;
     [[nodiscard]] bool canAddDevice(const DeviceParams& deviceParams) const;
     [[nodiscard]] AddressRange getRealAddressRange(const AddressRange& range, uint32_t baseAddress) const;
@@ -54,6 +141,12 @@ private:
 private:
 
     std::vector<DeviceParams> devices_;
+    PageTable<const std::byte> readPages_ = PageTable<const std::byte>(PAGES_COUNT);
+    PageTable<std::byte> writePages_ = PageTable<std::byte>(PAGES_COUNT);
+    mutable UnmappedAccessLog unmappedAccessLog_;
+    /// Pages holding cached instructions; a write to one is reported to codeWriteListeners_
+    std::vector<uint8_t> watchedCodePages_ = std::vector<uint8_t>(PAGES_COUNT);
+    std::vector<CodeWriteListener*> codeWriteListeners_;
 };
 
 } // namespace DataExchange
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file unmapped_access_log.h
+ * @brief Lock-free record of bus accesses that hit no device.
+ *
+ * Software probing unmapped space (open-bus reads, TMSS checks) must not pay
+ * for string formatting inside the instruction loop. The bus records such
+ * accesses here and a frontend drains and logs them outside the hot loop.
+ *
+ * The log is a single-producer/single-consumer ring: record() is called from
+ * the emulation thread, drain() from one consumer thread. When the ring is
+ * full new entries are counted as dropped instead of overwriting old ones.
+ */
+
+namespace DataExchange {
+
+enum class AccessDirection : uint8_t {
+    READ,
+    WRITE
+};
+
+struct UnmappedAccess {
+    uint32_t address;
+    AccessDirection direction;
+};
+
+class UnmappedAccessLog {
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    UnmappedAccessLog() = default;
+    ~UnmappedAccessLog() = default;
+
+    /** @name Copying snapshots the log; not thread-safe */
+    /// @{
+    UnmappedAccessLog(const UnmappedAccessLog& other);
+    UnmappedAccessLog& operator=(const UnmappedAccessLog& other);
+    UnmappedAccessLog(UnmappedAccessLog&& other) noexcept;
+    UnmappedAccessLog& operator=(UnmappedAccessLog&& other) noexcept;
+    /// @}
+
+    /**
+     * @brief Record an unmapped access (producer side, wait-free).
+     */
+    void record(uint32_t address, AccessDirection direction) noexcept
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+
+        if (head - tail >= CAPACITY) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        entries_[head & (CAPACITY - 1)] = UnmappedAccess{.address = address, .direction = direction}; //NOLINT(*-constant-array-index)
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Hand every pending entry to consumer and remove it from the log (consumer side).
+     * @return Number of drained entries.
+     */
+    template <typename Consumer>
+    size_t drain(Consumer&& consumer)
+    {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_acquire);
+
+        const auto count = static_cast<size_t>(head - tail);
+        for (; tail != head; ++tail) {
+            consumer(entries_[tail & (CAPACITY - 1)]); //NOLINT(*-constant-array-index)
+        }
+
+        tail_.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    /** @brief Total number of unmapped accesses recorded, including dropped ones. */
+    [[nodiscard]] uint64_t totalCount() const noexcept
+    {
+        return head_.load(std::memory_order_relaxed) + dropped_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Number of accesses not stored because the log was full. */
+    [[nodiscard]] uint64_t droppedCount() const noexcept
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    std::array<UnmappedAccess, CAPACITY> entries_{};
+    std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+inline UnmappedAccessLog::UnmappedAccessLog(const UnmappedAccessLog& other) :
+    entries_(other.entries_),
+    head_(other.head_.load(std::memory_order_relaxed)),
+    tail_(other.tail_.load(std::memory_order_relaxed)),
+    dropped_(other.dropped_.load(std::memory_order_relaxed))
+{
+
+}
+
+inline UnmappedAccessLog& UnmappedAccessLog::operator=(const UnmappedAccessLog& other)
+{
+    if (this != &other) {
+        entries_ = other.entries_;
+        head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        dropped_.store(other.dropped_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+inline UnmappedAccessLog::UnmappedAccessLog(UnmappedAccessLog&& other) noexcept : UnmappedAccessLog(other) //NOLINT(*-move-constructor-init)
+{
+
+}
+
+inline UnmappedAccessLog& UnmappedAccessLog::operator=(UnmappedAccessLog&& other) noexcept
+{
+    return *this = other;
+}
+
+} // namespace DataExchange
@@ -1,16 +1,53 @@
 #include "bus/bus.h"
 #include "spdlog/spdlog.h"
 #include <algorithm>
+#include <big_endian.h>
+#include <cstring>
+
+/**
+ * Formatting a log line for every unmapped access is too expensive for the access path.
+ * Such accesses are recorded in unmappedAccessLog_ instead; per-access spdlog tracing is
+ * compiled in only when BUS_TRACE_UNMAPPED_ACCESS is defined (never in Release builds).
+ */
+#if defined(BUS_TRACE_UNMAPPED_ACCESS)
+#define BUS_TRACE_UNMAPPED(...) spdlog::warn(__VA_ARGS__)
+#else
+#define BUS_TRACE_UNMAPPED(...) static_cast<void>(0)
+#endif
 
 namespace DataExchange {
 
+void Bus::checkCodeWrite(uint32_t address)
+{
+    const uint32_t pageIndex = address >> PAGE_SHIFT;
+    if (watchedCodePages_[pageIndex] == 0) [[likely]] {
+        return;
+    }
+
+    watchedCodePages_[pageIndex] = 0;
+    for (auto* listener : codeWriteListeners_) {
+        listener->onCodeWrite(pageIndex << PAGE_SHIFT, PAGE_SIZE);
+    }
+}
+
 std::expected<MemoryAccessResult, MemoryAccessError> Bus::read16(uint32_t address) const
 {
     const uint32_t alignedAddr = address & ~1U;
 
+    if (alignedAddr < PAGE_TABLE_ADDRESS_SPACE) {
+        const auto& page = readPages_[alignedAddr >> PAGE_SHIFT];
+        if (page.memory != nullptr) {
+            return MemoryAccessResult{
+                .data = loadBigEndian<uint16_t>(page.memory + (alignedAddr - page.baseAddress)),
+                .waitCycles = 0
+            };
+        }
+    }
+
     auto deviceOpt = findDevice(OperationType::READ, alignedAddr);
     if (!deviceOpt.has_value()) {
-        spdlog::error("Read attempt from unmapped address: 0x{:08X}", alignedAddr);
+        unmappedAccessLog_.record(alignedAddr, AccessDirection::READ);
+        BUS_TRACE_UNMAPPED("Read attempt from unmapped address: 0x{:08X}", alignedAddr);
         return std::unexpected(MemoryAccessError::READ_FROM_UNMAPPED_ADDRESS);
     }
 
@@ -27,9 +64,20 @@ std::expected<void, MemoryAccessError> Bus::write16(uint32_t address, uint16_t v
 {
     const uint32_t alignedAddr = address & ~1U;
 
+    if (alignedAddr < PAGE_TABLE_ADDRESS_SPACE) {
+        checkCodeWrite(alignedAddr);
+
+        const auto& page = writePages_[alignedAddr >> PAGE_SHIFT];
+        if (page.memory != nullptr) {
+            storeBigEndian(page.memory + (alignedAddr - page.baseAddress), value);
+            return {};
+        }
+    }
+
     auto deviceOpt = findDevice(OperationType::WRITE, alignedAddr);
     if (!deviceOpt.has_value()) {
-        spdlog::error("Write attempt to unmapped address: 0x{:08X}", alignedAddr);
+        unmappedAccessLog_.record(alignedAddr, AccessDirection::WRITE);
+        BUS_TRACE_UNMAPPED("Write attempt to unmapped address: 0x{:08X}", alignedAddr);
         return std::unexpected(MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
     }
 
@@ -38,6 +86,280 @@ std::expected<void, MemoryAccessError> Bus::write16(uint32_t address, uint16_t v
     return {};
 }
 
+std::expected<MemoryAccessResult8, MemoryAccessError> Bus::read8(uint32_t address) const
+{
+    if (address < PAGE_TABLE_ADDRESS_SPACE) {
+        const auto& page = readPages_[address >> PAGE_SHIFT];
+        if (page.memory != nullptr) {
+            return MemoryAccessResult8{
+                .data = std::to_integer<uint8_t>(page.memory[address - page.baseAddress]),
+                .waitCycles = 0
+            };
+        }
+    }
+
+    auto deviceOpt = findDevice(OperationType::READ, address);
+    if (!deviceOpt.has_value()) {
+        unmappedAccessLog_.record(address, AccessDirection::READ);
+        BUS_TRACE_UNMAPPED("Read attempt from unmapped address: 0x{:08X}", address);
+        return std::unexpected(MemoryAccessError::READ_FROM_UNMAPPED_ADDRESS);
+    }
+
+    auto& [deviceRef, offset] = deviceOpt.value();
+
+    return MemoryAccessResult8{
+        .data = deviceRef.get().read8(offset),
+        .waitCycles = 0
+    };
+}
+
+std::expected<void, MemoryAccessError> Bus::write8(uint32_t address, uint8_t value)
+{
+    if (address < PAGE_TABLE_ADDRESS_SPACE) {
+        checkCodeWrite(address);
+
+        const auto& page = writePages_[address >> PAGE_SHIFT];
+        if (page.memory != nullptr) {
+            page.memory[address - page.baseAddress] = static_cast<std::byte>(value);
+            return {};
+        }
+    }
+
+    auto deviceOpt = findDevice(OperationType::WRITE, address);
+    if (!deviceOpt.has_value()) {
+        unmappedAccessLog_.record(address, AccessDirection::WRITE);
+        BUS_TRACE_UNMAPPED("Write attempt to unmapped address: 0x{:08X}", address);
+        return std::unexpected(MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
+    }
+
+    auto& [deviceRef, offset] = deviceOpt.value();
+    deviceRef.get().write8(offset, value);
+    return {};
+}
+
+std::expected<MemoryAccessResult32, MemoryAccessError> Bus::read32(uint32_t address) const
+{
+    const uint32_t alignedAddr = address & ~1U;
+
+    /// A long inside one fully mapped page costs a single lookup; otherwise it is two word accesses
+    if (alignedAddr < PAGE_TABLE_ADDRESS_SPACE && isLongInsidePage(alignedAddr)) {
+        const auto& page = readPages_[alignedAddr >> PAGE_SHIFT];
+
+        if (page.memory != nullptr) {
+            return MemoryAccessResult32{
+                .data = loadBigEndian<uint32_t>(page.memory + (alignedAddr - page.baseAddress)),
+                .waitCycles = 0
+            };
+        }
+
+        if (page.device != nullptr) {
+            return MemoryAccessResult32{
+                .data = page.device->read32(alignedAddr - page.baseAddress),
+                .waitCycles = 0
+            };
+        }
+    }
+
+    return MemoryInterface::read32(alignedAddr);
+}
+
+std::expected<void, MemoryAccessError> Bus::write32(uint32_t address, uint32_t value)
+{
+    const uint32_t alignedAddr = address & ~1U;
+
+    if (alignedAddr < PAGE_TABLE_ADDRESS_SPACE && isLongInsidePage(alignedAddr)) {
+        checkCodeWrite(alignedAddr);
+
+        const auto& page = writePages_[alignedAddr >> PAGE_SHIFT];
+
+        if (page.memory != nullptr) {
+            storeBigEndian(page.memory + (alignedAddr - page.baseAddress), value);
+            return {};
+        }
+
+        if (page.device != nullptr) {
+            page.device->write32(alignedAddr - page.baseAddress, value);
+            return {};
+        }
+    }
+
+    return MemoryInterface::write32(alignedAddr, value);
+}
+
+CodeMemoryType Bus::codeMemoryType(uint32_t address) const
+{
+    if (address >= PAGE_TABLE_ADDRESS_SPACE) {
+        return CodeMemoryType::UNCACHEABLE;
+    }
+
+    const auto& readPage = readPages_[address >> PAGE_SHIFT];
+    const auto& writePage = writePages_[address >> PAGE_SHIFT];
+
+    if (readPage.device == nullptr || readPage.shared || writePage.shared) {
+        return CodeMemoryType::UNCACHEABLE;
+    }
+
+    if (writePage.device == nullptr) {
+        return CodeMemoryType::READ_ONLY;
+    }
+
+    /// only direct RAM is tracked: writes through device callbacks may have side effects we cannot see
+    if (readPage.memory != nullptr && writePage.memory != nullptr) {
+        return CodeMemoryType::WRITABLE;
+    }
+
+    return CodeMemoryType::UNCACHEABLE;
+}
+
+size_t Bus::peekCodeWords(uint32_t address, std::span<uint16_t> words) const
+{
+    const uint32_t alignedAddr = address & ~1U;
+    if (alignedAddr >= PAGE_TABLE_ADDRESS_SPACE) {
+        return 0;
+    }
+
+    const auto& page = readPages_[alignedAddr >> PAGE_SHIFT];
+    if (page.memory == nullptr) {
+        return 0;
+    }
+
+    const uint32_t pageEnd = (alignedAddr | (PAGE_SIZE - 1)) + 1;
+    const size_t count = std::min<size_t>(words.size(), (pageEnd - alignedAddr) / sizeof(uint16_t));
+    const std::byte* source = page.memory + (alignedAddr - page.baseAddress);
+
+    for (size_t i = 0; i < count; ++i) {
+        words[i] = loadBigEndian<uint16_t>(source + (i * sizeof(uint16_t)));
+    }
+
+    return count;
+}
+
+template <typename ByteType>
+bool Bus::isDirectRange(const PageTable<ByteType>& pageTable, uint32_t address, uint32_t length)
+{
+    const uint64_t end = static_cast<uint64_t>(address) + length;
+    if (length == 0 || end > PAGE_TABLE_ADDRESS_SPACE) {
+        return false;
+    }
+
+    for (uint64_t pageIndex = address >> PAGE_SHIFT; pageIndex <= (end - 1) >> PAGE_SHIFT; ++pageIndex) {
+        if (pageTable[pageIndex].memory == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ByteType>
+ByteType* Bus::directPointer(const PageTable<ByteType>& pageTable, uint32_t address)
+{
+    const auto& page = pageTable[address >> PAGE_SHIFT];
+    return page.memory + (address - page.baseAddress);
+}
+
+bool Bus::copyMemory(uint32_t destination, uint32_t source, uint32_t length)
+{
+    /// ascending writes into a destination ahead of the source would copy what they just wrote
+    if (destination > source && destination - source < length) {
+        return false;
+    }
+    if (!isDirectRange(readPages_, source, length) || !isDirectRange(writePages_, destination, length)) {
+        return false;
+    }
+
+    for (uint32_t offset = 0; offset < length;) {
+        const uint32_t sourceAddress = source + offset;
+        const uint32_t destinationAddress = destination + offset;
+        const uint32_t chunk = std::min({length - offset, PAGE_SIZE - (sourceAddress & (PAGE_SIZE - 1)),
+                                         PAGE_SIZE - (destinationAddress & (PAGE_SIZE - 1))});
+
+        checkCodeWrite(destinationAddress);
+        std::memmove(directPointer(writePages_, destinationAddress), directPointer(readPages_, sourceAddress), chunk);
+        offset += chunk;
+    }
+    return true;
+}
+
+bool Bus::fillMemory(uint32_t destination, uint32_t length, std::span<const uint8_t> pattern)
+{
+    if (pattern.empty() || !isDirectRange(writePages_, destination, length)) {
+        return false;
+    }
+
+    for (uint32_t offset = 0; offset < length;) {
+        const uint32_t address = destination + offset;
+        const uint32_t chunk = std::min(length - offset, PAGE_SIZE - (address & (PAGE_SIZE - 1)));
+        checkCodeWrite(address);
+
+        /// one pattern in phase with destination, then doubled
+        std::byte* output = directPointer(writePages_, address);
+        size_t filled = std::min<size_t>(chunk, pattern.size());
+        for (size_t i = 0; i < filled; ++i) {
+            output[i] = static_cast<std::byte>(pattern[(offset + i) % pattern.size()]); //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        while (filled < chunk) {
+            const size_t count = std::min<size_t>(filled, chunk - filled);
+            std::memcpy(output + filled, output, count); //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            filled += count;
+        }
+
+        offset += chunk;
+    }
+    return true;
+}
+
+bool Bus::readHasSideEffects(uint32_t address) const
+{
+    if (address < PAGE_TABLE_ADDRESS_SPACE && readPages_[address >> PAGE_SHIFT].memory != nullptr) {
+        return false;
+    }
+
+    const auto deviceOpt = findDevice(OperationType::READ, address);
+    if (!deviceOpt.has_value()) {
+        return true;
+    }
+
+    return deviceOpt->device.get().readHasSideEffects(deviceOpt->addressOffset);
+}
+
+void Bus::watchCodeWrites(uint32_t address)
+{
+    if (address < PAGE_TABLE_ADDRESS_SPACE) {
+        watchedCodePages_[address >> PAGE_SHIFT] = 1;
+    }
+}
+
+void Bus::addCodeWriteListener(CodeWriteListener* listener)
+{
+    if (listener != nullptr && std::ranges::find(codeWriteListeners_, listener) == codeWriteListeners_.end()) {
+        codeWriteListeners_.push_back(listener);
+    }
+}
+
+void Bus::removeCodeWriteListener(CodeWriteListener* listener)
+{
+    std::erase(codeWriteListeners_, listener);
+
+    /// pages watched for the removed listener would otherwise report one stray write
+    if (codeWriteListeners_.empty()) {
+        std::ranges::fill(watchedCodePages_, 0);
+    }
+}
+
+UnmappedAccessLog& Bus::unmappedAccessLog() const
+{
+    return unmappedAccessLog_;
+}
+
+size_t Bus::logUnmappedAccesses() const
+{
+    return unmappedAccessLog_.drain([](const UnmappedAccess& access) {
+        spdlog::warn("Unmapped {} at address 0x{:08X}",
+                     (access.direction == AccessDirection::READ) ? "read" : "write",
+                     access.address);
+    });
+}
+
 bool Bus::mapDevice(DeviceParams deviceParams)
 {
     if (!deviceParams.device) {
@@ -50,11 +372,79 @@ bool Bus::mapDevice(DeviceParams deviceParams)
         return false;
     } 
           
+    if (deviceParams.readRange) {
+        fillPageTable(readPages_, deviceParams, getRealAddressRange(*deviceParams.readRange, deviceParams.baseAddress),
+                      deviceParams.device->readableMemory());
+    }
+
+    if (deviceParams.writeRange) {
+        fillPageTable(writePages_, deviceParams, getRealAddressRange(*deviceParams.writeRange, deviceParams.baseAddress),
+                      deviceParams.device->writableMemory());
+    }
+
     devices_.emplace_back(std::move(deviceParams));
     return true;
 }
 
+template <typename ByteType>
+void Bus::fillPageTable(PageTable<ByteType>& pageTable, const DeviceParams& deviceParams, const AddressRange& range, std::span<ByteType> memory)
+{
+    if (range.start >= PAGE_TABLE_ADDRESS_SPACE) {
+        return;
+    }
+
+    const uint32_t lastAddress = std::min(range.end, PAGE_TABLE_ADDRESS_SPACE - 1);
+    for (uint32_t page = range.start >> PAGE_SHIFT; page <= (lastAddress >> PAGE_SHIFT); ++page) {
+        const uint32_t pageStart = page << PAGE_SHIFT;
+        const uint32_t pageEnd = pageStart + PAGE_SIZE - 1;
+
+        auto& entry = pageTable[page];
+        if (range.start <= pageStart && range.end >= pageEnd) {
+            /// Direct only when the device storage backs every byte of the page
+            const bool isDirect = !memory.empty() && (pageEnd - deviceParams.baseAddress) < memory.size();
+
+            entry = PageEntry<ByteType>{
+                .device = deviceParams.device.get(),
+                .memory = isDirect ? memory.data() : nullptr,
+                .baseAddress = deviceParams.baseAddress,
+                .shared = false
+            };
+        } else {
+            entry = PageEntry<ByteType>{.device = nullptr, .memory = nullptr, .baseAddress = 0, .shared = true};
+        }
+    }
+}
+
 std::optional<Bus::DeviceMatcher> Bus::findDevice(OperationType operationType, uint32_t address) const
+{
+    if (address >= PAGE_TABLE_ADDRESS_SPACE) {
+        return scanDevices(operationType, address);
+    }
+
+    return (operationType == OperationType::READ) ? findDeviceInPages(readPages_, operationType, address)
+                                                  : findDeviceInPages(writePages_, operationType, address);
+}
+
+template <typename ByteType>
+std::optional<Bus::DeviceMatcher> Bus::findDeviceInPages(const PageTable<ByteType>& pageTable, OperationType operationType, uint32_t address) const
+{
+    const auto& entry = pageTable[address >> PAGE_SHIFT];
+
+    if (entry.device != nullptr) {
+        return DeviceMatcher{
+            .device = std::reference_wrapper<IBusDevice>(*entry.device),
+            .addressOffset = address - entry.baseAddress
+        };
+    }
+
+    if (entry.shared) {
+        return scanDevices(operationType, address);
+    }
+
+    return std::nullopt;
+}
+
+std::optional<Bus::DeviceMatcher> Bus::scanDevices(OperationType operationType, uint32_t address) const
 {
     for (const auto& mapping : devices_) {
 
@@ -72,10 +462,6 @@ std::optional<Bus::DeviceMatcher> Bus::findDevice(OperationType operationType, u
         }
     }
 
-    spdlog::warn("No device found for address 0x{:08X} during {} operation.",
-                  address,
-                  (operationType == OperationType::READ) ? "read" : "write");
-
     return std::nullopt;
 }
 
@@ -141,6 +527,12 @@ AddressRange Bus::getRealAddressRange(const AddressRange& range, uint32_t baseAd
     };
 }
 
+bool Bus::isLongInsidePage(uint32_t address)
+{
+    constexpr uint32_t longSize = 4;
+    return (address & (PAGE_SIZE - 1)) <= PAGE_SIZE - longSize;
+}
+
 bool Bus::isAddressInRange(uint32_t address, const AddressRange& range) const //NOLINT
 {
     return address >= range.start && address <= range.end;
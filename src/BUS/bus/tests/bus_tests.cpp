@@ -1,5 +1,7 @@
 #include "bus/bus.h"
 #include "mock_bus_device.h"
+#include "mock_memory_device.h"
+#include <array>
 #include <gtest/gtest.h>
 
 
@@ -182,3 +184,390 @@ TEST(BusTest, ThreeDevicesMappedCorrectly) {
     ASSERT_TRUE(readResult3);
     EXPECT_EQ(readResult3.value().data, 0x3333); //NOL
 }
+
+TEST(BusTest, DeviceSpanningSeveralPages) {
+    DataExchange::Bus bus;
+
+    auto device = std::make_shared<BusTests::MockBusDevice>();
+
+    DataExchange::DeviceParams params;
+    params.device = device;
+    params.baseAddress = 0x10000; //NOLINT
+    params.readRange = DataExchange::AddressRange{.start=0x0000, .end=0x307F}; //NOLINT
+    params.writeRange = std::nullopt;
+
+    ASSERT_TRUE(bus.mapDevice(std::move(params)));
+
+    EXPECT_CALL(*device, read16(0x0000)).Times(1).WillOnce(testing::Return(0x1111)); //NOLINT
+    EXPECT_CALL(*device, read16(0x2FFE)).Times(1).WillOnce(testing::Return(0x2222)); //NOLINT
+    EXPECT_CALL(*device, read16(0x307E)).Times(1).WillOnce(testing::Return(0x3333)); //NOLINT
+
+    auto readResult = bus.read16(0x10000); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x1111); //NOLINT
+
+    readResult = bus.read16(0x12FFE); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x2222); //NOLINT
+
+    // last page is only partly covered by the device
+    readResult = bus.read16(0x1307E); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x3333); //NOLINT
+
+    readResult = bus.read16(0x13080); //NOLINT
+    ASSERT_FALSE(readResult);
+    EXPECT_EQ(readResult.error(), DataExchange::MemoryAccessError::READ_FROM_UNMAPPED_ADDRESS);
+
+    auto writeResult = bus.write16(0x10000, 0xABCD); //NOLINT
+    ASSERT_FALSE(writeResult);
+    EXPECT_EQ(writeResult.error(), DataExchange::MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
+}
+
+TEST(BusTest, DeviceMappedAbovePageTableAddressSpace) {
+    DataExchange::Bus bus;
+
+    auto device = std::make_shared<BusTests::MockBusDevice>();
+
+    DataExchange::DeviceParams params;
+    params.device = device;
+    params.baseAddress = 0x20000000; //NOLINT
+    params.readRange = DataExchange::AddressRange{.start=0x0000, .end=0x00FF}; //NOLINT
+    params.writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x00FF}; //NOLINT
+
+    ASSERT_TRUE(bus.mapDevice(std::move(params)));
+
+    EXPECT_CALL(*device, write16(0x10, 0xAAAA)).Times(1); //NOLINT
+    EXPECT_CALL(*device, read16(0x20)).Times(1).WillOnce(testing::Return(0x1234)); //NOLINT
+
+    auto writeResult = bus.write16(0x20000010, 0xAAAA); //NOLINT
+    ASSERT_TRUE(writeResult);
+
+    auto readResult = bus.read16(0x20000020); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x1234); //NOLINT
+}
+
+TEST(BusTest, DirectMemoryPagesBypassDevice) {
+    DataExchange::Bus bus;
+
+    auto device = std::make_shared<BusTests::MockMemoryDevice>(0x2000); //NOLINT
+    device->memory()[0x0010] = std::byte{0x12}; //NOLINT
+    device->memory()[0x0011] = std::byte{0x34}; //NOLINT
+
+    EXPECT_CALL(*device, read16(testing::_)).Times(0);
+    EXPECT_CALL(*device, write16(testing::_, testing::_)).Times(0);
+
+    DataExchange::DeviceParams params;
+    params.device = device;
+    params.baseAddress = 0xFF0000; //NOLINT
+    params.readRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}; //NOLINT
+    params.writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}; //NOLINT
+
+    ASSERT_TRUE(bus.mapDevice(std::move(params)));
+
+    auto readResult = bus.read16(0xFF0010); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x1234); //NOLINT
+
+    auto writeResult = bus.write16(0xFF1FFE, 0xBEEF); //NOLINT
+    ASSERT_TRUE(writeResult);
+    EXPECT_EQ(device->memory()[0x1FFE], std::byte{0xBE}); //NOLINT
+    EXPECT_EQ(device->memory()[0x1FFF], std::byte{0xEF}); //NOLINT
+
+    readResult = bus.read16(0xFF1FFF); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0xBEEF); //NOLINT
+}
+
+TEST(BusTest, ByteAndLongAccessesOnDirectPages) {
+    DataExchange::Bus bus;
+
+    auto device = std::make_shared<BusTests::MockMemoryDevice>(0x2000); //NOLINT
+
+    EXPECT_CALL(*device, read16(testing::_)).Times(0);
+    EXPECT_CALL(*device, write16(testing::_, testing::_)).Times(0);
+
+    DataExchange::DeviceParams params;
+    params.device = device;
+    params.baseAddress = 0xFF0000; //NOLINT
+    params.readRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}; //NOLINT
+    params.writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}; //NOLINT
+
+    ASSERT_TRUE(bus.mapDevice(std::move(params)));
+
+    ASSERT_TRUE(bus.write32(0xFF0100, 0x12345678)); //NOLINT
+    EXPECT_EQ(device->memory()[0x0100], std::byte{0x12}); //NOLINT
+    EXPECT_EQ(device->memory()[0x0103], std::byte{0x78}); //NOLINT
+
+    ASSERT_TRUE(bus.write8(0xFF0101, 0xAB)); //NOLINT
+    EXPECT_EQ(device->memory()[0x0100], std::byte{0x12}); //NOLINT
+    EXPECT_EQ(device->memory()[0x0101], std::byte{0xAB}); //NOLINT
+
+    auto byteResult = bus.read8(0xFF0102); //NOLINT
+    ASSERT_TRUE(byteResult);
+    EXPECT_EQ(byteResult.value().data, 0x56); //NOLINT
+
+    auto longResult = bus.read32(0xFF0100); //NOLINT
+    ASSERT_TRUE(longResult);
+    EXPECT_EQ(longResult.value().data, 0x12AB5678); //NOLINT
+
+    /// a long straddling two pages is split into word accesses
+    ASSERT_TRUE(bus.write32(0xFF0FFE, 0xCAFEBABE)); //NOLINT
+    longResult = bus.read32(0xFF0FFE); //NOLINT
+    ASSERT_TRUE(longResult);
+    EXPECT_EQ(longResult.value().data, 0xCAFEBABE); //NOLINT
+}
+
+TEST(BusTest, LongAccessToUnmappedAddressFails) {
+    DataExchange::Bus bus;
+
+    EXPECT_FALSE(bus.read8(0x1000)); //NOLINT
+    EXPECT_FALSE(bus.read32(0x1000)); //NOLINT
+    EXPECT_FALSE(bus.write8(0x1000, 0)); //NOLINT
+    EXPECT_FALSE(bus.write32(0x1000, 0)); //NOLINT
+}
+
+TEST(BusTest, PagesBeyondDeviceMemoryUseCallbacks) {
+    DataExchange::Bus bus;
+
+    // storage backs only the first page of the mapped range
+    auto device = std::make_shared<BusTests::MockMemoryDevice>(DataExchange::Bus::PAGE_SIZE);
+
+    DataExchange::DeviceParams params;
+    params.device = device;
+    params.baseAddress = 0x0000; //NOLINT
+    params.readRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}; //NOLINT
+    params.writeRange = std::nullopt;
+
+    ASSERT_TRUE(bus.mapDevice(std::move(params)));
+
+    EXPECT_CALL(*device, read16(0x0FFE)).Times(0);
+    EXPECT_CALL(*device, read16(0x1000)).Times(1).WillOnce(testing::Return(0x5678)); //NOLINT
+
+    auto readResult = bus.read16(0x0FFE); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0); //NOLINT
+
+    readResult = bus.read16(0x1000); //NOLINT
+    ASSERT_TRUE(readResult);
+    EXPECT_EQ(readResult.value().data, 0x5678); //NOLINT
+}
+
+TEST(BusTest, UnmappedAccessesAreRecorded) {
+    DataExchange::Bus bus;
+
+    ASSERT_FALSE(bus.read16(0xA14000)); //NOLINT
+    ASSERT_FALSE(bus.write16(0xA14101, 0x1234)); //NOLINT
+
+    EXPECT_EQ(bus.unmappedAccessLog().totalCount(), 2);
+
+    std::vector<DataExchange::UnmappedAccess> accesses;
+    const auto drained = bus.unmappedAccessLog().drain([&](const DataExchange::UnmappedAccess& access) {
+        accesses.push_back(access);
+    });
+
+    ASSERT_EQ(drained, 2);
+    EXPECT_EQ(accesses[0].address, 0xA14000); //NOLINT
+    EXPECT_EQ(accesses[0].direction, DataExchange::AccessDirection::READ);
+    EXPECT_EQ(accesses[1].address, 0xA14100); //NOLINT
+    EXPECT_EQ(accesses[1].direction, DataExchange::AccessDirection::WRITE);
+
+    EXPECT_EQ(bus.logUnmappedAccesses(), 0);
+}
+
+TEST(BusTest, UnmappedAccessLogCountsDroppedEntries) {
+    DataExchange::UnmappedAccessLog log;
+
+    constexpr size_t extraAccesses = 3;
+    for (size_t i = 0; i < DataExchange::UnmappedAccessLog::CAPACITY + extraAccesses; ++i) {
+        log.record(static_cast<uint32_t>(i * 2), DataExchange::AccessDirection::READ);
+    }
+
+    EXPECT_EQ(log.droppedCount(), extraAccesses);
+    EXPECT_EQ(log.totalCount(), DataExchange::UnmappedAccessLog::CAPACITY + extraAccesses);
+
+    uint32_t expectedAddress = 0;
+    const auto drained = log.drain([&](const DataExchange::UnmappedAccess& access) {
+        EXPECT_EQ(access.address, expectedAddress);
+        expectedAddress += 2;
+    });
+
+    EXPECT_EQ(drained, DataExchange::UnmappedAccessLog::CAPACITY);
+
+    log.record(0x100, DataExchange::AccessDirection::WRITE); //NOLINT
+    EXPECT_EQ(log.drain([](const DataExchange::UnmappedAccess&) {}), 1);
+}
+
+namespace {
+class RecordingCodeWriteListener : public DataExchange::CodeWriteListener {
+public:
+    void onCodeWrite(uint32_t pageStart, uint32_t pageSize) override
+    {
+        writes.emplace_back(pageStart, pageSize);
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> writes;
+};
+} // namespace
+
+TEST(BusTest, CodeMemoryTypeFollowsPageMapping) {
+    DataExchange::Bus bus;
+
+    auto rom = std::make_shared<BusTests::MockMemoryDevice>(0x1000); //NOLINT
+    auto ram = std::make_shared<BusTests::MockMemoryDevice>(0x1000); //NOLINT
+    auto io = std::make_shared<BusTests::MockBusDevice>();
+
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = rom, .baseAddress = 0x000000,
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = std::nullopt}));
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = ram, .baseAddress = 0xFF0000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}})); //NOLINT
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = io, .baseAddress = 0xA10000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}})); //NOLINT
+
+    EXPECT_EQ(bus.codeMemoryType(0x000100), DataExchange::CodeMemoryType::READ_ONLY); //NOLINT
+    EXPECT_EQ(bus.codeMemoryType(0xFF0100), DataExchange::CodeMemoryType::WRITABLE); //NOLINT
+    EXPECT_EQ(bus.codeMemoryType(0xA10000), DataExchange::CodeMemoryType::UNCACHEABLE); //NOLINT
+    EXPECT_EQ(bus.codeMemoryType(0x400000), DataExchange::CodeMemoryType::UNCACHEABLE); //NOLINT
+}
+
+TEST(BusTest, WriteToWatchedCodePageIsReportedOnce) {
+    DataExchange::Bus bus;
+    RecordingCodeWriteListener listener;
+    bus.addCodeWriteListener(&listener);
+
+    auto ram = std::make_shared<BusTests::MockMemoryDevice>(0x2000); //NOLINT
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = ram, .baseAddress = 0xFF0000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}})); //NOLINT
+
+    bus.watchCodeWrites(0xFF1010); //NOLINT
+
+    ASSERT_TRUE(bus.write16(0xFF0010, 0x4E71)); //NOLINT
+    EXPECT_TRUE(listener.writes.empty());
+
+    ASSERT_TRUE(bus.write8(0xFF1FFF, 0x71)); //NOLINT
+    ASSERT_TRUE(bus.write32(0xFF1000, 0x4E714E71)); //NOLINT
+
+    ASSERT_EQ(listener.writes.size(), 1);
+    EXPECT_EQ(listener.writes[0].first, 0xFF1000); //NOLINT
+    EXPECT_EQ(listener.writes[0].second, DataExchange::Bus::PAGE_SIZE);
+
+    bus.removeCodeWriteListener(&listener);
+}
+
+TEST(BusTest, PeekCodeWordsStopsAtDirectPageEnd) {
+    DataExchange::Bus bus;
+
+    auto ram = std::make_shared<BusTests::MockMemoryDevice>(0x1000); //NOLINT
+    auto io = std::make_shared<BusTests::MockBusDevice>();
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = ram, .baseAddress = 0xFF0000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}})); //NOLINT
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = io, .baseAddress = 0xA10000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = std::nullopt}));
+
+    ASSERT_TRUE(bus.write32(0xFF0FFC, 0x4E714E75)); //NOLINT
+    ASSERT_TRUE(bus.write16(0xFF0100, 0x7001)); //NOLINT
+
+    std::array<uint16_t, 5> words{};
+    ASSERT_EQ(bus.peekCodeWords(0xFF0100, words), words.size()); //NOLINT
+    EXPECT_EQ(words[0], 0x7001); //NOLINT
+
+    ASSERT_EQ(bus.peekCodeWords(0xFF0FFC, words), 2); //NOLINT
+    EXPECT_EQ(words[0], 0x4E71); //NOLINT
+    EXPECT_EQ(words[1], 0x4E75); //NOLINT
+
+    /// device callbacks may have side effects, so I/O is never peeked
+    EXPECT_EQ(bus.peekCodeWords(0xA10000, words), 0); //NOLINT
+    EXPECT_EQ(bus.peekCodeWords(0x400000, words), 0); //NOLINT
+}
+
+TEST(BusTest, ReadSideEffectsComeFromThePageOwner) {
+    DataExchange::Bus bus;
+
+    auto ram = std::make_shared<BusTests::MockMemoryDevice>(0x1000); //NOLINT
+    auto io = std::make_shared<BusTests::MockBusDevice>();
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = ram, .baseAddress = 0xFF0000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}})); //NOLINT
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = io, .baseAddress = 0xC00000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x001F}, //NOLINT
+        .writeRange = std::nullopt}));
+
+    EXPECT_CALL(*io, readHasSideEffects(0x04)).WillOnce(testing::Return(false)); //NOLINT
+    EXPECT_CALL(*io, readHasSideEffects(0x00)).WillOnce(testing::Return(true));
+
+    EXPECT_FALSE(bus.readHasSideEffects(0xFF0100)); //NOLINT
+    EXPECT_FALSE(bus.readHasSideEffects(0xC00004)); //NOLINT
+    EXPECT_TRUE(bus.readHasSideEffects(0xC00000)); //NOLINT
+    EXPECT_TRUE(bus.readHasSideEffects(0x400000)); //NOLINT
+}
+
+TEST(BusTest, BulkCopyAndFillUseDirectPagesOnly) {
+    DataExchange::Bus bus;
+    RecordingCodeWriteListener listener;
+    bus.addCodeWriteListener(&listener);
+
+    auto rom = std::make_shared<BusTests::MockMemoryDevice>(0x1000); //NOLINT
+    auto ram = std::make_shared<BusTests::MockMemoryDevice>(0x2000); //NOLINT
+    auto io = std::make_shared<BusTests::MockBusDevice>();
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = rom, .baseAddress = 0x000000,
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = std::nullopt}));
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = ram, .baseAddress = 0xFF0000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x1FFF}})); //NOLINT
+    ASSERT_TRUE(bus.mapDevice(DataExchange::DeviceParams{
+        .device = io, .baseAddress = 0xA10000, //NOLINT
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0x0FFF}})); //NOLINT
+
+    for (size_t i = 0; i < 8; ++i) { //NOLINT
+        rom->memory()[0x10 + i] = static_cast<std::byte>(i + 1); //NOLINT
+    }
+
+    /// ROM to RAM across a RAM page boundary, reporting the watched page
+    bus.watchCodeWrites(0xFF1000); //NOLINT
+    ASSERT_TRUE(bus.copyMemory(0xFF0FFC, 0x000010, 8)); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF0FFC)->data, 0x01020304); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF1000)->data, 0x05060708); //NOLINT
+    ASSERT_EQ(listener.writes.size(), 1);
+    EXPECT_EQ(listener.writes[0].first, 0xFF1000); //NOLINT
+
+    /// moving down over itself is fine, moving up would repeat the first bytes
+    ASSERT_TRUE(bus.copyMemory(0xFF0FFA, 0xFF0FFC, 8)); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF0FFE)->data, 0x05060708); //NOLINT
+    EXPECT_FALSE(bus.copyMemory(0xFF0FFE, 0xFF0FFA, 8)); //NOLINT
+
+    EXPECT_FALSE(bus.copyMemory(0x000100, 0xFF0000, 4)); //NOLINT
+    EXPECT_FALSE(bus.copyMemory(0xFF0000, 0xA10000, 4)); //NOLINT
+    EXPECT_FALSE(bus.copyMemory(0xFF1FFE, 0x000010, 4)); //NOLINT
+
+    const std::array<uint8_t, 4> pattern = {0x12, 0x34, 0x56, 0x78}; //NOLINT
+    ASSERT_TRUE(bus.fillMemory(0xFF0FF8, 14, pattern)); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF0FF8)->data, 0x12345678); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF0FFC)->data, 0x12345678); //NOLINT
+    EXPECT_EQ(bus.read32(0xFF1000)->data, 0x12345678); //NOLINT
+    EXPECT_EQ(bus.read16(0xFF1004)->data, 0x1234); //NOLINT
+    EXPECT_EQ(bus.read16(0xFF1006)->data, 0); //NOLINT
+
+    EXPECT_FALSE(bus.fillMemory(0x000000, 4, pattern)); //NOLINT
+    EXPECT_FALSE(bus.fillMemory(0xA10000, 4, pattern)); //NOLINT
+
+    bus.removeCodeWriteListener(&listener);
+}
@@ -8,6 +8,7 @@ class MockBusDevice : public DataExchange::IBusDevice {
 public:
     MOCK_METHOD(uint16_t, read16, (uint32_t offset), (override));
     MOCK_METHOD(void, write16, (uint32_t offset, uint16_t value), (override));
+    MOCK_METHOD(bool, readHasSideEffects, (uint32_t offset), (const, override));
 };
 
 } // namespace BusTests
\ No newline at end of file
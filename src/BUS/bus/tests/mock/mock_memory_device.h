@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <gmock/gmock.h>
+#include <ibusdevice.h>
+#include <span>
+#include <vector>
+
+namespace BusTests {
+
+/// Device exposing its storage to the bus; read16/write16 are mocked to check they are bypassed
+class MockMemoryDevice : public DataExchange::IBusDevice {
+public:
+    explicit MockMemoryDevice(size_t sizeBytes) : memory_(sizeBytes) {}
+
+    MOCK_METHOD(uint16_t, read16, (uint32_t offset), (override));
+    MOCK_METHOD(void, write16, (uint32_t offset, uint16_t value), (override));
+
+    std::span<const std::byte> readableMemory() override { return memory_; }
+    std::span<std::byte> writableMemory() override { return memory_; }
+
+    std::vector<std::byte>& memory() { return memory_; }
+
+private:
+    std::vector<std::byte> memory_;
+};
+
+} // namespace BusTests
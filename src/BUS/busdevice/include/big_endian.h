@@ -0,0 +1,40 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @file big_endian.h
+ * @brief Loads and stores of m68k (big-endian) values from host byte storage.
+ *
+ * Used by memory-backed devices and by the bus for direct pages. Each access is a
+ * single unaligned host load/store plus a byte swap on little-endian hosts.
+ */
+
+namespace DataExchange {
+
+template <std::unsigned_integral T>
+[[nodiscard]] inline T loadBigEndian(const std::byte* memory)
+{
+    T value{};
+    std::memcpy(&value, memory, sizeof(value));
+
+    if constexpr (std::endian::native == std::endian::little) {
+        value = std::byteswap(value);
+    }
+
+    return value;
+}
+
+template <std::unsigned_integral T>
+inline void storeBigEndian(std::byte* memory, T value)
+{
+    if constexpr (std::endian::native == std::endian::little) {
+        value = std::byteswap(value);
+    }
+
+    std::memcpy(memory, &value, sizeof(value));
+}
+
+} // namespace DataExchange
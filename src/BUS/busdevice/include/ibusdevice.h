@@ -1,5 +1,7 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 /**
  * @file ibusdevice.h
@@ -13,6 +15,9 @@
  * Implementations are expected to handle address range checks, alignment,
  * side-effects (MMIO) and any required synchronization if accessed from
  * multiple threads.
+ *
+ * Side-effect free devices (RAM, ROM) may additionally expose their backing
+ * storage, which lets the bus access it directly without virtual dispatch.
  */
 
 
@@ -61,6 +66,79 @@ public:
      * the emulator's conventions.
      */
     virtual void write16(uint32_t addr, uint16_t val) = 0;
+
+    /**
+     * @brief Read a byte from the device at the given byte address.
+     *
+     * Default implementation picks the byte out of read16() of the containing
+     * word (high byte at even addresses).
+     */
+    virtual uint8_t read8(uint32_t addr)
+    {
+        const uint16_t word = read16(addr & ~1U);
+        return static_cast<uint8_t>((addr & 1U) ? (word & 0xFFU) : (word >> 8U)); //NOLINT(*-magic-numbers)
+    }
+
+    /**
+     * @brief Write a byte to the device at the given byte address.
+     *
+     * Default implementation is a read-modify-write of the containing word.
+     * Devices where that is observable (MMIO) or wasteful (memory) should override it.
+     */
+    virtual void write8(uint32_t addr, uint8_t val)
+    {
+        const uint16_t word = read16(addr & ~1U);
+        write16(addr & ~1U, (addr & 1U) ? static_cast<uint16_t>((word & 0xFF00U) | val) //NOLINT(*-magic-numbers)
+                                        : static_cast<uint16_t>((word & 0x00FFU) | (val << 8U))); //NOLINT(*-magic-numbers)
+    }
+
+    /**
+     * @brief Read a big-endian 32-bit value. Default: two read16() calls.
+     */
+    virtual uint32_t read32(uint32_t addr)
+    {
+        const uint32_t high = read16(addr);
+        const uint32_t low = read16(addr + 2);
+        return (high << 16U) | low; //NOLINT(*-magic-numbers)
+    }
+
+    /**
+     * @brief Write a big-endian 32-bit value. Default: two write16() calls, high word first.
+     */
+    virtual void write32(uint32_t addr, uint32_t val)
+    {
+        write16(addr, static_cast<uint16_t>(val >> 16U)); //NOLINT(*-magic-numbers)
+        write16(addr + 2, static_cast<uint16_t>(val));
+    }
+
+    /**
+     * @brief Contiguous big-endian storage the bus may read directly.
+     * @return Span indexed by device byte address, or an empty span (default)
+     *         when reads must go through read16().
+     *
+     * Only devices whose reads have no side-effects should return storage here.
+     * The span must stay valid for the lifetime of the device.
+     */
+    virtual std::span<const std::byte> readableMemory() { return {}; }
+
+    /**
+     * @brief Contiguous big-endian storage the bus may write directly.
+     * @return Span indexed by device byte address, or an empty span (default)
+     *         when writes must go through write16().
+     *
+     * Only devices whose writes have no side-effects should return storage here.
+     * The span must stay valid for the lifetime of the device.
+     */
+    virtual std::span<std::byte> writableMemory() { return {}; }
+
+    /**
+     * @brief Whether reading the given byte address changes device state.
+     *
+     * Default: true. Devices with registers that are only polled, such as a status
+     * register whose read clears nothing, may return false for them so the CPU can
+     * fast-forward loops that wait on them.
+     */
+    [[nodiscard]] virtual bool readHasSideEffects(uint32_t /*addr*/) const { return true; }
 };
 
 } // namespace DataExchange
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <span>
 
 namespace DataExchange {
 
@@ -9,11 +11,41 @@ enum class MemoryAccessError : uint8_t {
     WRITE_TO_UNMAPPED_ADDRESS
 };
 
-struct MemoryAccessResult {
-    uint16_t data;
+template <typename DataType>
+struct BasicMemoryAccessResult {
+    DataType data;
     int waitCycles; 
 };
 
+using MemoryAccessResult = BasicMemoryAccessResult<uint16_t>;
+using MemoryAccessResult8 = BasicMemoryAccessResult<uint8_t>;
+using MemoryAccessResult32 = BasicMemoryAccessResult<uint32_t>;
+
+/// Whether decoded instructions at an address may be cached, see MemoryInterface::codeMemoryType()
+enum class CodeMemoryType : uint8_t {
+    UNCACHEABLE, ///< I/O or unmapped memory, must be decoded on every fetch
+    READ_ONLY,   ///< ROM, cached instructions never become stale
+    WRITABLE     ///< RAM, cached instructions must be dropped when the page is written
+};
+
+/// Receives writes to pages registered via MemoryInterface::watchCodeWrites()
+class CodeWriteListener {
+public:
+    CodeWriteListener() = default;
+    CodeWriteListener(const CodeWriteListener&) = default;
+    CodeWriteListener(CodeWriteListener&&) = default;
+    CodeWriteListener& operator=(const CodeWriteListener&) = default;
+    CodeWriteListener& operator=(CodeWriteListener&&) = default;
+    virtual ~CodeWriteListener() = default;
+
+    /**
+     * @brief Called once after the first write to a watched page; the page is no longer watched afterwards.
+     * @param pageStart First address of the written page.
+     * @param pageSize Page size in bytes.
+     */
+    virtual void onCodeWrite(uint32_t pageStart, uint32_t pageSize) = 0;
+};
+
 class MemoryInterface {
 public:
     MemoryInterface() = default;
@@ -24,6 +56,155 @@ public:
 
     [[nodiscard]] virtual std::expected<MemoryAccessResult, MemoryAccessError> read16(uint32_t address) const = 0;
     [[nodiscard]] virtual std::expected<void, MemoryAccessError> write16(uint32_t address, uint16_t value) = 0;
+
+    /**
+     * @brief Read a byte. Default: picks the byte out of read16() (high byte at even addresses).
+     */
+    [[nodiscard]] virtual std::expected<MemoryAccessResult8, MemoryAccessError> read8(uint32_t address) const
+    {
+        const auto readResult = read16(address);
+        if (!readResult) {
+            return std::unexpected(readResult.error());
+        }
+
+        return MemoryAccessResult8{
+            .data = static_cast<uint8_t>((address & 1U) ? (readResult->data & 0xFFU) : (readResult->data >> 8U)), //NOLINT(*-magic-numbers)
+            .waitCycles = readResult->waitCycles
+        };
+    }
+
+    /**
+     * @brief Write a byte. Default: read-modify-write of the containing word;
+     *        implementations should override it to leave the neighbouring byte untouched.
+     */
+    [[nodiscard]] virtual std::expected<void, MemoryAccessError> write8(uint32_t address, uint8_t value)
+    {
+        const auto readResult = read16(address);
+        if (!readResult) {
+            return std::unexpected(MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
+        }
+
+        const auto word = (address & 1U) ? static_cast<uint16_t>((readResult->data & 0xFF00U) | value) //NOLINT(*-magic-numbers)
+                                         : static_cast<uint16_t>((readResult->data & 0x00FFU) | (value << 8U)); //NOLINT(*-magic-numbers)
+        return write16(address, word);
+    }
+
+    /**
+     * @brief Read a big-endian long. Default: two read16() calls.
+     */
+    [[nodiscard]] virtual std::expected<MemoryAccessResult32, MemoryAccessError> read32(uint32_t address) const
+    {
+        const auto highResult = read16(address);
+        if (!highResult) {
+            return std::unexpected(highResult.error());
+        }
+
+        const auto lowResult = read16(address + 2);
+        if (!lowResult) {
+            return std::unexpected(lowResult.error());
+        }
+
+        return MemoryAccessResult32{
+            .data = (static_cast<uint32_t>(highResult->data) << 16U) | static_cast<uint32_t>(lowResult->data), //NOLINT(*-magic-numbers)
+            .waitCycles = highResult->waitCycles + lowResult->waitCycles
+        };
+    }
+
+    /**
+     * @brief Write a big-endian long. Default: two write16() calls, high word first.
+     */
+    [[nodiscard]] virtual std::expected<void, MemoryAccessError> write32(uint32_t address, uint32_t value)
+    {
+        const auto highResult = write16(address, static_cast<uint16_t>(value >> 16U)); //NOLINT(*-magic-numbers)
+        if (!highResult) {
+            return highResult;
+        }
+
+        return write16(address + 2, static_cast<uint16_t>(value));
+    }
+
+    /**
+     * @brief Kind of memory backing an address, used by the CPU to decide whether to cache decoded instructions.
+     *        Default: UNCACHEABLE, so implementations without write tracking are always re-decoded.
+     */
+    [[nodiscard]] virtual CodeMemoryType codeMemoryType(uint32_t /*address*/) const
+    {
+        return CodeMemoryType::UNCACHEABLE;
+    }
+
+    /**
+     * @brief Copy consecutive words starting at address from memory that can be read without side effects.
+     * @param words Destination, filled with host-order word values.
+     * @return Number of words copied, fewer than words.size() where such memory ends.
+     *         Default: 0, so callers fall back to read16().
+     *
+     * Lets the instruction decoder fetch an opcode and its extension words at once.
+     */
+    [[nodiscard]] virtual size_t peekCodeWords(uint32_t /*address*/, std::span<uint16_t> /*words*/) const
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Copy length bytes like ascending byte writes would, if every byte of source is
+     *        memory readable without side effects and every byte of destination plain memory.
+     * @return false, with nothing copied, when a range is not such memory or destination starts
+     *         inside (source, source + length). Default: false, so callers fall back to accesses.
+     *
+     * Lets the CPU run memory copy loops in one call.
+     */
+    [[nodiscard]] virtual bool copyMemory(uint32_t /*destination*/, uint32_t /*source*/, uint32_t /*length*/)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Fill length bytes with pattern repeated from destination on, under the same
+     *        conditions as copyMemory().
+     * @return false, with nothing written, when the range is not plain memory.
+     *         Default: false, so callers fall back to accesses.
+     */
+    [[nodiscard]] virtual bool fillMemory(uint32_t /*destination*/, uint32_t /*length*/, std::span<const uint8_t> /*pattern*/)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Whether a read of address may change state, i.e. reading it twice may not
+     *        return the same value with nothing else running in between.
+     *        Default: true.
+     *
+     * Lets the CPU recognize idle loops that only poll memory.
+     */
+    [[nodiscard]] virtual bool readHasSideEffects(uint32_t /*address*/) const
+    {
+        return true;
+    }
+
+    /**
+     * @brief Report the next write to the page containing address to the code write listeners.
+     */
+    virtual void watchCodeWrites(uint32_t /*address*/)
+    {
+
+    }
+
+    /**
+     * @brief Register a listener notified about writes to watched pages.
+     */
+    virtual void addCodeWriteListener(CodeWriteListener* /*listener*/)
+    {
+
+    }
+
+    /**
+     * @brief Unregister a listener added with addCodeWriteListener().
+     */
+    virtual void removeCodeWriteListener(CodeWriteListener* /*listener*/)
+    {
+
+    }
+
     virtual ~MemoryInterface() = default;
 };
 
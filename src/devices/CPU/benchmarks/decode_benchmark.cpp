@@ -0,0 +1,133 @@
+#include <bus/bus.h>
+#include <chrono>
+#include <cpu/internal/instruction_decoder/decode_result.h>
+#include <cpu/internal/instruction_decoder/instruction_decoder.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <ram/ram.h>
+#include <vector>
+
+/**
+ * @file decode_benchmark.cpp
+ * @brief Decode throughput with and without the packed instruction record.
+ *
+ * Fills 8 KB of RAM, the span the decode cache covers, with a mix of short and
+ * extension-word instructions and decodes it repeatedly:
+ *  - decode:       InstructionDecoder::decode(), storing full DecodeResult values
+ *  - decodePacked: the same decode, storing PackedInstruction records
+ *  - decodeCached: decode cache hits after the first pass
+ */
+
+namespace {
+
+constexpr uint32_t CODE_SIZE = 0x2000;
+constexpr int PASSES = 200;
+
+/// MOVEQ #1,D0 / LEA (-8,A0),A1 / NOP / DBF D0,*-2 / BNE.W *+$10
+constexpr uint16_t CODE_PATTERN[] = {0x7001, 0x43E8, 0xFFF8, 0x4E71, 0x51C8, 0xFFFE, 0x6600, 0x000E}; //NOLINT
+constexpr uint32_t INSTRUCTIONS_PER_PATTERN = 5;
+
+template <typename Function>
+double measureInstructionsPerSecond(uint64_t instructionsCount, Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(instructionsCount) / elapsed.count();
+}
+
+} // namespace
+
+int main(int, char**)
+{
+    auto ram = std::make_shared<DataExchange::RAM>(CODE_SIZE);
+    const uint32_t patternBytes = sizeof(CODE_PATTERN);
+    const uint32_t patternsCount = CODE_SIZE / patternBytes;
+
+    for (uint32_t pattern = 0; pattern < patternsCount; ++pattern) {
+        uint32_t address = pattern * patternBytes;
+        for (const auto word : CODE_PATTERN) {
+            (void)ram->write16(address, word);
+            address += sizeof(word);
+        }
+    }
+
+    auto bus = std::make_shared<DataExchange::Bus>();
+    const bool mapped = bus->mapDevice(DataExchange::DeviceParams{
+        .device = ram,
+        .baseAddress = 0,
+        .readRange = DataExchange::AddressRange{.start = 0, .end = CODE_SIZE - 1},
+        .writeRange = DataExchange::AddressRange{.start = 0, .end = CODE_SIZE - 1}
+    });
+    if (!mapped) {
+        std::fprintf(stderr, "Failed to map RAM\n"); //NOLINT
+        return 1;
+    }
+
+    m68k::InstructionDecoder decoder(bus);
+    const uint64_t instructionsCount = static_cast<uint64_t>(patternsCount) * INSTRUCTIONS_PER_PATTERN * PASSES;
+    bool failed = false;
+
+    std::vector<m68k::DecodeResult> results;
+    results.reserve(patternsCount * INSTRUCTIONS_PER_PATTERN);
+    const double decodeRate = measureInstructionsPerSecond(instructionsCount, [&] {
+        for (int pass = 0; pass < PASSES; ++pass) {
+            results.clear();
+            for (uint32_t pc = 0; pc < patternsCount * patternBytes;) { //NOLINT(*-identifier-length)
+                auto result = decoder.decode(pc);
+                if (!result) {
+                    failed = true;
+                    return;
+                }
+                pc += result->instructionSizeBytes;
+                results.push_back(std::move(result.value()));
+            }
+        }
+    });
+
+    std::vector<m68k::PackedInstruction> packedResults;
+    packedResults.reserve(patternsCount * INSTRUCTIONS_PER_PATTERN);
+    const double decodePackedRate = measureInstructionsPerSecond(instructionsCount, [&] {
+        for (int pass = 0; pass < PASSES; ++pass) {
+            packedResults.clear();
+            for (uint32_t pc = 0; pc < patternsCount * patternBytes;) { //NOLINT(*-identifier-length)
+                const auto result = decoder.decodePacked(pc);
+                if (!result) {
+                    failed = true;
+                    return;
+                }
+                pc += result->lengthBytes;
+                packedResults.push_back(result.value());
+            }
+        }
+    });
+
+    uint64_t checksum = 0;
+    const double decodeCachedRate = measureInstructionsPerSecond(instructionsCount, [&] {
+        for (int pass = 0; pass < PASSES; ++pass) {
+            for (uint32_t pc = 0; pc < patternsCount * patternBytes;) { //NOLINT(*-identifier-length)
+                const auto result = decoder.decodeCached(pc);
+                if (!result) {
+                    failed = true;
+                    return;
+                }
+                pc += result->lengthBytes;
+                checksum += static_cast<uint64_t>(result->type);
+            }
+        }
+    });
+
+    if (failed) {
+        std::fprintf(stderr, "Decode failed\n"); //NOLINT
+        return 1;
+    }
+
+    std::printf("record size: DecodeResult %zu bytes, PackedInstruction %zu bytes\n", sizeof(m68k::DecodeResult), sizeof(m68k::PackedInstruction)); //NOLINT
+    std::printf("decode        %10.2f M instructions/s\n", decodeRate / 1e6); //NOLINT
+    std::printf("decodePacked  %10.2f M instructions/s\n", decodePackedRate / 1e6); //NOLINT
+    std::printf("decodeCached  %10.2f M instructions/s (checksum %llu)\n", decodeCachedRate / 1e6, static_cast<unsigned long long>(checksum)); //NOLINT
+
+    return 0;
+}
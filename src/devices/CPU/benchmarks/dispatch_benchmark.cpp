@@ -0,0 +1,149 @@
+#include <array>
+#include <bus/bus.h>
+#include <chrono>
+#include <cpu/cpu.h>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <ram/ram.h>
+#include <rom/filerom.h>
+#include <string>
+
+/**
+ * @file dispatch_benchmark.cpp
+ * @brief Emulation speed of the configured block dispatch loop on a ROM workload.
+ *
+ * Built once against the configured CPU library and, except with M68K_X86_64_JIT, once
+ * against a copy built with the other M68K_THREADED_DISPATCH setting, so both loops run
+ * the same workload:
+ *  - no argument: a generated ROM with an instruction mix the executors implement, a
+ *    nested MOVEQ/NOP/Bcc/DBcc loop ending in STOP; reports instructions/s
+ *  - a ROM file: reset and run FRAMES NTSC frames of it; reports emulated cycles/s
+ */
+
+namespace {
+
+#if defined(M68K_X86_64_JIT)
+constexpr const char* DISPATCH_NAME = "portable + x86-64";
+#elif defined(M68K_THREADED_DISPATCH)
+constexpr const char* DISPATCH_NAME = "threaded";
+#else
+constexpr const char* DISPATCH_NAME = "portable";
+#endif
+
+constexpr uint32_t WORK_RAM_BASE = 0xFF0000;
+constexpr uint32_t WORK_RAM_SIZE = 0x10000;
+constexpr int64_t CYCLES_PER_FRAME = 53'693'175 / 7 / 60;
+constexpr int FRAMES = 600;
+
+constexpr uint32_t OUTER_LOOPS = 20000;
+/// MOVEQ #99,D0, 100 inner iterations of 5 instructions, DBF D6
+constexpr uint64_t INSTRUCTIONS_PER_OUTER_LOOP = 1 + 100 * 5 + 1;
+
+/// Vectors: SSP in work RAM, PC 0x100
+constexpr std::array<uint16_t, 4> VECTORS = {0x00FF, 0x8000, 0x0000, 0x0100};
+constexpr uint32_t PROGRAM_START = 0x100;
+/// a whole bus page, partially mapped pages are not cached
+constexpr uint32_t WORKLOAD_ROM_SIZE = 0x1000;
+constexpr std::array<uint16_t, 12> PROGRAM = {
+    0x7063,         ///< 0x100 outer: MOVEQ #99,D0
+    0x7201,         ///< 0x102 inner: MOVEQ #1,D1
+    0x4E71,         ///< 0x104        NOP
+    0x74FF,         ///< 0x106        MOVEQ #-1,D2
+    0x6B02,         ///< 0x108        BMI.S skip
+    0x4E71,         ///< 0x10A        NOP
+    0x51C8, 0xFFF4, ///< 0x10C skip:  DBF D0,inner
+    0x51CE, 0xFFEE, ///< 0x110        DBF D6,outer
+    0x4E72, 0x2700  ///< 0x114        STOP #$2700
+};
+
+std::filesystem::path writeWorkloadRom()
+{
+    std::array<uint8_t, WORKLOAD_ROM_SIZE> image{};
+    auto put = [&image](uint32_t address, uint16_t word) {
+        image.at(address) = static_cast<uint8_t>(word >> 8U);
+        image.at(address + 1) = static_cast<uint8_t>(word);
+    };
+
+    for(uint32_t i = 0; i < VECTORS.size(); ++i) {
+        put(i * 2, VECTORS.at(i));
+    }
+    for(uint32_t i = 0; i < PROGRAM.size(); ++i) {
+        put(PROGRAM_START + i * 2, PROGRAM.at(i));
+    }
+
+    const auto path = std::filesystem::temp_directory_path() / "m68k_dispatch_benchmark.bin";
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(image.data()), image.size()); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return path;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool builtinWorkload = argc < 2;
+    const std::string romPath = builtinWorkload ? writeWorkloadRom().string() : argv[1]; //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto rom = std::make_shared<DataExchange::FileROM>(romPath.c_str());
+    auto workRam = std::make_shared<DataExchange::RAM>(WORK_RAM_SIZE);
+    auto bus = std::make_shared<DataExchange::Bus>();
+    const bool mapped = bus->mapDevice(DataExchange::DeviceParams{
+                            .device = rom,
+                            .baseAddress = 0,
+                            .readRange = DataExchange::AddressRange{.start = 0, .end = builtinWorkload ? WORKLOAD_ROM_SIZE - 1 : 0x07FFFFU},
+                            .writeRange = std::nullopt}) &&
+                        bus->mapDevice(DataExchange::DeviceParams{
+                            .device = workRam,
+                            .baseAddress = WORK_RAM_BASE,
+                            .readRange = DataExchange::AddressRange{.start = 0, .end = WORK_RAM_SIZE - 1},
+                            .writeRange = DataExchange::AddressRange{.start = 0, .end = WORK_RAM_SIZE - 1}});
+    if (!mapped) {
+        std::fprintf(stderr, "Failed to map the ROM and work RAM\n"); //NOLINT
+        return 1;
+    }
+
+    m68k::CPU cpu(bus);
+    if (!cpu.reset()) {
+        std::fprintf(stderr, "Failed to read the reset vectors\n"); //NOLINT
+        return 1;
+    }
+    cpu.registers().D(6) = OUTER_LOOPS - 1;
+
+    const auto start = std::chrono::steady_clock::now();
+    int64_t usedCycles = 0;
+    if (builtinWorkload) {
+        /// STOP ends the budget
+        const auto result = cpu.run(std::numeric_limits<int64_t>::max());
+        if (!result) {
+            std::fprintf(stderr, "The workload stopped on an error\n"); //NOLINT
+            return 1;
+        }
+    } else {
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            const auto result = cpu.run(CYCLES_PER_FRAME);
+            if (!result) {
+                std::fprintf(stderr, "The ROM stopped on an unimplemented instruction or a double bus fault after %lld cycles\n", //NOLINT
+                             static_cast<long long>(usedCycles));
+                break;
+            }
+            usedCycles += *result;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (builtinWorkload) {
+        const uint64_t instructionsCount = OUTER_LOOPS * INSTRUCTIONS_PER_OUTER_LOOP + 1;
+        std::printf("%s dispatch %10.2f M instructions/s\n", DISPATCH_NAME, static_cast<double>(instructionsCount) / elapsed.count() / 1e6); //NOLINT
+    } else {
+        const int64_t executedCycles = usedCycles - cpu.fastForwardedCycles();
+        std::printf("%s dispatch %10.2f M cycles/s (%.1f%% fast-forwarded)\n", DISPATCH_NAME, //NOLINT
+                    static_cast<double>(executedCycles) / elapsed.count() / 1e6,
+                    usedCycles > 0 ? 100.0 * static_cast<double>(cpu.fastForwardedCycles()) / static_cast<double>(usedCycles) : 0.0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <chrono>
+#include <cpu/internal/instruction_executor/condition.h>
+#include <cpu/internal/instruction_executor/lazy_flags.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @file flags_benchmark.cpp
+ * @brief Condition code cost of ALU-heavy code, computed eagerly and lazily.
+ *
+ * Replays a stream of ADD/SUB/CMP/AND results of mixed sizes where, as in typical
+ * 68000 code, only every BRANCH_INTERVAL-th result is tested by a branch:
+ *  - eager: the flags of every operation are computed into SR
+ *  - lazy:  operations are recorded, flags are computed only for the branch
+ */
+
+namespace {
+
+using m68k::OperationSize;
+using m68k::executors_::LazyFlags;
+
+constexpr uint32_t OPERATIONS_COUNT = 1U << 16U;
+constexpr uint32_t BRANCH_INTERVAL = 8;
+constexpr int PASSES = 500;
+
+struct AluOperation {
+    LazyFlags::Operation operation;
+    OperationSize size;
+    uint32_t source;
+    uint32_t destination;
+};
+
+std::vector<AluOperation> makeOperations()
+{
+    std::vector<AluOperation> operations;
+    operations.reserve(OPERATIONS_COUNT);
+
+    uint32_t seed = 0x12345678; //NOLINT(*-magic-numbers)
+    auto next = [&seed] {
+        /// xorshift32
+        seed ^= seed << 13U; //NOLINT(*-magic-numbers)
+        seed ^= seed >> 17U; //NOLINT(*-magic-numbers)
+        seed ^= seed << 5U;  //NOLINT(*-magic-numbers)
+        return seed;
+    };
+
+    constexpr LazyFlags::Operation KINDS[] = {LazyFlags::Operation::ADD, LazyFlags::Operation::SUB,
+                                              LazyFlags::Operation::COMPARE, LazyFlags::Operation::LOGIC};
+    constexpr OperationSize SIZES[] = {OperationSize::BYTE, OperationSize::WORD, OperationSize::LONG};
+    for (uint32_t i = 0; i < OPERATIONS_COUNT; ++i) {
+        operations.push_back({.operation = KINDS[next() % 4], .size = SIZES[next() % 3], .source = next(), .destination = next()}); //NOLINT
+    }
+    return operations;
+}
+
+void record(LazyFlags& flags, const AluOperation& alu)
+{
+    switch (alu.operation) {
+    case LazyFlags::Operation::ADD:
+        flags.setAdd(alu.size, alu.source, alu.destination, alu.destination + alu.source);
+        break;
+    case LazyFlags::Operation::SUB:
+        flags.setSub(alu.size, alu.source, alu.destination, alu.destination - alu.source);
+        break;
+    case LazyFlags::Operation::COMPARE:
+        flags.setCompare(alu.size, alu.source, alu.destination, alu.destination - alu.source);
+        break;
+    case LazyFlags::Operation::NONE:
+    case LazyFlags::Operation::LOGIC:
+        flags.setLogic(alu.size, alu.destination & alu.source);
+        break;
+    }
+}
+
+template <typename Function>
+double measureOperationsPerSecond(Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(OPERATIONS_COUNT) * PASSES / elapsed.count();
+}
+
+template <bool Eager>
+uint64_t replay(const std::vector<AluOperation>& operations)
+{
+    LazyFlags flags;
+    m68k_::StatusRegister sr{};
+    uint64_t taken = 0;
+
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (uint32_t i = 0; i < OPERATIONS_COUNT; ++i) {
+            record(flags, operations[i]);
+            if constexpr (Eager) {
+                flags.materialize(sr);
+            }
+            if (i % BRANCH_INTERVAL == BRANCH_INTERVAL - 1) {
+                taken += m68k::executors_::testCondition(m68k::Condition::GREATER_THAN, flags.materialize(sr)) ? 1 : 0;
+            }
+        }
+    }
+    return taken;
+}
+
+} // namespace
+
+int main(int, char**)
+{
+    const auto operations = makeOperations();
+
+    uint64_t eagerTaken = 0;
+    const double eagerRate = measureOperationsPerSecond([&] { eagerTaken = replay<true>(operations); });
+
+    uint64_t lazyTaken = 0;
+    const double lazyRate = measureOperationsPerSecond([&] { lazyTaken = replay<false>(operations); });
+
+    if (eagerTaken != lazyTaken) {
+        std::fprintf(stderr, "Lazy flags disagree with eager flags\n"); //NOLINT
+        return 1;
+    }
+
+    std::printf("eager flags %10.2f M operations/s\n", eagerRate / 1e6); //NOLINT
+    std::printf("lazy flags  %10.2f M operations/s (branches taken %llu)\n", lazyRate / 1e6, static_cast<unsigned long long>(lazyTaken)); //NOLINT
+
+    return 0;
+}
@@ -1,9 +1,17 @@
 #pragma once
-#include <cpu/internal/instruction_executor/base_executor.h>
+#include <cpu/cpu_error.h>
+#include <cpu/interrupt_controller.h>
+#include <cpu/internal/instruction_decoder/block_cache.h>
 #include <cpu/internal/instruction_decoder/instruction_decoder.h>
 #include <cpu/internal/registers.h>
+#include <cpu/internal/instruction_executor/exception_vector.h>
+#include <cpu/internal/instruction_executor/execution_context.h>
+#include <cpu/internal/instruction_executor/lazy_flags.h>
+#include <cstdint>
+#include <expected>
 #include <memory>
 #include <memoryinterface.h>
+#include <optional>
 
 namespace m68k {
 
@@ -11,21 +19,181 @@ class CPU {
 public:
     explicit CPU(std::shared_ptr<DataExchange::MemoryInterface> bus);
 
-    void reset();
+    /**
+     * @brief Load SSP and PC from the reset vectors and enter supervisor mode.
+     * @return CPUError::HALTED when the vectors cannot be read.
+     */
+    std::expected<void, CPUError> reset();
 
-    void executeNextInstruction();
+    /**
+     * @brief Execute one instruction, or the exception processing of its fault.
+     *
+     * Illegal and line A/F opcodes, odd PCs and bus errors are handled as 68000
+     * exceptions; only host-level failures are returned as errors.
+     */
+    std::expected<void, CPUError> executeNextInstruction();
 
+    /**
+     * @brief Execute the predecoded basic block starting at PC.
+     *
+     * Stops early when an instruction moves PC off the straight-line path
+     * or overwrites the block's own code.
+     */
+    std::expected<void, CPUError> executeBlock();
+
+    /**
+     * @brief Execute instructions until cycles are consumed or requestStop() is called.
+     * @return Cycles actually used; whole instructions are executed, so this may exceed
+     *         cycles by the length of the last one.
+     *
+     * Intended to be called once per frame or scanline with the time left until the next
+     * device event.
+     *
+     * The rest of the budget is skipped rather than executed while the CPU waits in STOP,
+     * and whole iterations of idle loops are skipped once they provably change nothing:
+     * polling loops that only read side-effect free memory into unchanged registers and
+     * DBcc delay loops. Devices are assumed not to change what such a loop reads within
+     * one run() slice.
+     *
+     * Copy and fill loops (see LoopIdiom) over direct RAM or ROM run as one bulk copy or
+     * fill, with the registers, flags and cycles their iterations would leave.
+     */
+    std::expected<int64_t, CPUError> run(int64_t cycles);
+
+    /**
+     * @brief Make run() return after the current instruction, e.g. from a device access
+     *        that needs the other devices to catch up.
+     */
+    void requestStop();
+
+    /// Registers with up-to-date condition codes
     m68k_::Registers& registers();
+
+    /// Cycles counted by run() without executing instructions, in STOP or idle loops
+    [[nodiscard]] int64_t fastForwardedCycles() const;
+
+    /**
+     * @brief Instructions executed plus exceptions taken between instructions (interrupts,
+     *        fetch and odd PC faults), whatever method ran them.
+     *
+     * executeNextInstruction() advances it by at most one, so it lines up executions of
+     * the same code by different methods, see LockstepValidator.
+     */
+    [[nodiscard]] uint64_t steps() const;
+
+    /// IPL input, raised and lowered by devices
+    InterruptController& interruptController();
 private:
 
-    void initExecutors();
+    /**
+     * @brief Execute the block at PC while budget lasts and no stop is requested.
+     * @param fastForward Run() mode: skip further iterations of an idle loop block within
+     *                    budget, run copy and fill loops in bulk, and go on into the
+     *                    successors the block is linked to while nothing ends the batch
+     *                    (budget, requestStop(), an SR write or a pending interrupt)
+     * @return Cycles used.
+     */
+    std::expected<int64_t, CPUError> runBlock(int64_t budget, bool fastForward);
+
+    /// One block of runBlock(), already fetched or followed from its predecessor's link
+    std::expected<int64_t, CPUError> runFetchedBlock(const BasicBlock& block, int64_t budget, bool fastForward);
+
+    /**
+     * @brief The instruction loop of runBlock(): execute the block's instructions until one
+     *        leaves the straight-line path, budget is used or the batch has to end.
+     *
+     * A portable loop over the dispatch table, or with M68K_THREADED_DISPATCH a
+     * direct-threaded loop where every handler ends with its own indirect jump.
+     * @return Cycles used.
+     */
+    std::expected<int64_t, CPUError> runInstructions(const BasicBlock& block, int64_t budget);
+
+    /**
+     * @brief Call a native segment of a translated block and account for its instructions.
+     *
+     * Only the portable runInstructions() enters native segments, see M68K_X86_64_JIT.
+     */
+    void runNativeSegment(const NativeSegment& segment);
+
+    /**
+     * @brief Run the iterations of a copy or fill loop block that fit in budget as one bulk
+     *        memory operation, leaving registers, flags and PC as executing them would.
+     * @return Cycles used, or nothing when the loop has to be executed: fewer than two
+     *         iterations fit, an address is odd, it overwrites its own code or a range is
+     *         not direct memory.
+     */
+    std::optional<int64_t> runLoopIdiom(const BasicBlock& block, int64_t budget);
+
+    /**
+     * @brief Skip whole iterations of an idle loop that has just run once.
+     * @param before Registers before that iteration, compared for polling loops
+     * @return Cycles of the skipped iterations.
+     */
+    int64_t skipIdleLoop(const BasicBlock& block, const m68k_::Registers& before, int64_t iterationCycles, int64_t budget);
+
+    /**
+     * @brief Take a pending autovectored interrupt above the SR mask, if any.
+     * @return Cycles used, 0 when no interrupt was taken.
+     */
+    std::expected<int64_t, CPUError> serviceInterrupt();
+
+    /**
+     * @brief Execute one instruction whose PC has already been advanced.
+     * @param executor executeInstruction(), or the handler it resolves to for a translated block
+     * @return Clock cycles the instruction took, exception processing included.
+     */
+    std::expected<int64_t, CPUError> execute(const PackedInstruction& instruction, uint32_t instructionPc,
+                                             executors_::ExecutorFunction executor);
+
+    /// Cycles of an executed instruction, or the exception processing of its fault
+    std::expected<int64_t, CPUError> completeInstruction(const PackedInstruction& instruction, const executors_::ExecutionContext& context,
+                                                         const std::expected<void, ExecuteError>& executeResult);
+
+    /// Exception processing of an instruction that could not be fetched or decoded at pc
+    std::expected<int64_t, CPUError> fetchFault(uint32_t pc, DecodeError error); //NOLINT(*-identifier-length)
+
+    /// Exception processing of an executor error
+    std::expected<int64_t, CPUError> executeFault(const PackedInstruction& instruction, uint32_t instructionPc,
+                                                  const executors_::ExecutionContext& context, ExecuteError error);
+
+    /**
+     * @brief Group 1 and 2 exception processing: stack PC and SR on the supervisor stack
+     *        and continue at the handler read from the vector table.
+     *
+     * A bus or address error while doing so turns into a group 0 exception.
+     */
+    std::expected<void, CPUError> processException(ExceptionVector vector, uint32_t returnPc);
+
+    /// Access that caused a bus or address error
+    struct FaultAccess {
+        uint32_t address;
+        bool read;
+        bool instructionFetch;
+    };
+
+    /**
+     * @brief Group 0 (bus and address error) exception processing with its 14 byte frame.
+     *
+     * A fault while doing so is a double bus fault and halts the CPU.
+     */
+    std::expected<void, CPUError> processGroup0Exception(ExceptionVector vector, const FaultAccess& access, uint16_t instructionWord);
 
 private:
     m68k_::Registers regs_;
+    /// Condition codes not yet written to regs_.SR()
+    executors_::LazyFlags flags_;
     std::shared_ptr<DataExchange::MemoryInterface> bus_;
     std::unique_ptr<InstructionDecoder> instructionDecoder_;
-    /// Временный optional, когда все декодеры будут реализованы, он будет убран
-    std::vector<std::optional<std::unique_ptr<executors_::IExecutor>>> executors_;
+    std::unique_ptr<BlockCache> blockCache_;
+    InterruptController interruptController_;
+    bool stopRequested_ = false;
+    /// Set by an SR write so the batch ends and a newly unmasked interrupt is taken
+    bool endBatch_ = false;
+    bool halted_ = false;
+    /// Waiting in STOP for an interrupt
+    bool stopped_ = false;
+    int64_t fastForwardedCycles_ = 0;
+    uint64_t steps_ = 0;
 };
 
 } // namespace m68k
\ No newline at end of file
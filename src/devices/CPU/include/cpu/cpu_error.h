@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+namespace m68k {
+
+/**
+ * @brief Host-level failures of the CPU.
+ *
+ * Faults a guest program can cause (illegal opcodes, address and bus errors...) are not
+ * errors: they are processed as 68000 exceptions through the vector table.
+ */
+enum class CPUError : uint8_t {
+    UNIMPLEMENTED_INSTRUCTION,  ///< Decoded instruction has no executor yet
+    HALTED                      ///< Double bus fault or unreadable reset vector; only reset() recovers
+};
+
+} //namespace m68k
@@ -26,49 +26,41 @@ template<class DataType>
 requires AllowedTypes<DataType>
 std::expected<MemoryAccessResult<DataType>, DataExchange::MemoryAccessError> read(const DataExchange::MemoryInterface& bus, uint32_t address)
 {
-    if constexpr (std::is_same_v<DataType, std::uint8_t> || std::is_same_v<DataType, std::int8_t>) {
-
-        auto readResult = bus.read16(address);
-        if (!readResult) {
-            return std::unexpected(readResult.error());
+    auto readResult = [&bus, address] {
+        if constexpr (sizeof(DataType) == sizeof(uint8_t)) {
+            return bus.read8(address);
         }
-        
-        return MemoryAccessResult<DataType> {
-            .data = static_cast<DataType>((address & 1U) ? (readResult->data & 0xFFU) : (readResult->data >> 8U)), //NOLINT(*-magic-numbers)
-            .waitCycles = readResult->waitCycles
-        };
-    } 
-    else if constexpr (std::is_same_v<DataType, std::uint16_t> || std::is_same_v<DataType, std::int16_t>) {
-
-        auto readResult = bus.read16(address);
-        if (!readResult) {
-            return std::unexpected(readResult.error());
+        else if constexpr (sizeof(DataType) == sizeof(uint16_t)) {
+            return bus.read16(address);
         }
+        else {
+            return bus.read32(address);
+        }
+    }();
 
-        return MemoryAccessResult<DataType> {
-            .data = static_cast<DataType>(readResult->data), 
-            .waitCycles = readResult->waitCycles
-        };
+    if (!readResult) {
+        return std::unexpected(readResult.error());
     }
-    else if constexpr (std::is_same_v<DataType, std::uint32_t> || std::is_same_v<DataType, std::int32_t>) {
 
-        auto highResult = bus.read16(address);
-        if (!highResult) {
-            return std::unexpected(highResult.error());
-        }
-
-        auto lowResult = bus.read16(address + 2);
-        if (!lowResult) {
-            return std::unexpected(lowResult.error());
-        }
+    return MemoryAccessResult<DataType> {
+        .data = static_cast<DataType>(readResult->data),
+        .waitCycles = readResult->waitCycles
+    };
+}
 
-        return MemoryAccessResult<DataType> {
-            .data = static_cast<DataType>((static_cast<uint32_t>(highResult->data) << 16U) | static_cast<uint32_t>(lowResult->data)), //NOLINT(*-magic-numbers)
-            .waitCycles = highResult->waitCycles + lowResult->waitCycles
-        };
+template<class DataType>
+requires AllowedTypes<DataType>
+std::expected<void, DataExchange::MemoryAccessError> write(DataExchange::MemoryInterface& bus, uint32_t address, DataType value)
+{
+    if constexpr (sizeof(DataType) == sizeof(uint8_t)) {
+        return bus.write8(address, static_cast<uint8_t>(value));
+    }
+    else if constexpr (sizeof(DataType) == sizeof(uint16_t)) {
+        return bus.write16(address, static_cast<uint16_t>(value));
+    }
+    else {
+        return bus.write32(address, static_cast<uint32_t>(value));
     }
 }
 
-
-
 } // namespace m68k::busHelper
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+#include <cpu/internal/instruction_executor/executor.h>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace m68k {
+
+/**
+ * @brief Loops the CPU may fast-forward instead of executing every iteration.
+ */
+enum class IdleLoopKind : uint8_t {
+    NONE,
+    /// Branches back to its start and only reads side-effect free memory into registers:
+    /// once an iteration leaves the registers unchanged, every further one does too
+    POLLING,
+    /// A lone DBcc branching to itself, i.e. a delay loop
+    DBCC_DELAY
+};
+
+/**
+ * @brief Loops the CPU may run as one bulk memory operation.
+ *
+ * Both are a MOVE with a postincremented destination and a DBF branching back to it,
+ * executed once per element until the counter expires.
+ */
+enum class LoopIdiom : uint8_t {
+    NONE,
+    /// MOVE (Ax)+,(Ay)+ / DBF Dn
+    COPY,
+    /// MOVE Dx,(Ay)+ or MOVE #imm,(Ay)+ / DBF Dn, Dx not being the counter
+    FILL
+};
+
+/**
+ * @brief Host code of consecutive instructions of a translated block, see native_translator.h.
+ *
+ * Takes &Registers::D(0) and returns the N and Z bits of the last flag-setting instruction
+ * in their SR positions; V and C are cleared, as for every instruction it compiles.
+ */
+using NativeFunction = uint32_t (*)(uint32_t* dataRegisters);
+
+/**
+ * @brief Instructions of a block the dispatch loop runs as one call to host code.
+ *
+ * They only read and write data registers, so none of them can fault, leave the
+ * straight-line path or end the batch. The dispatch loop only has to check the budget:
+ * it enters the segment when the cycles before its last instruction do not use it up.
+ */
+struct NativeSegment {
+    NativeFunction entry = nullptr;     ///< Null where no segment starts
+    uint8_t instructionsCount = 0;
+    uint16_t lengthBytes = 0;
+    bool setsFlags = false;             ///< Whether the returned N and Z replace the condition codes
+    int64_t cycles = 0;
+    int64_t cyclesBeforeLast = 0;
+};
+
+/**
+ * @brief Straight-line run of predecoded instructions.
+ *
+ * A block starts at startPc and ends after the first instruction that may transfer
+ * control or change the supervisor/interrupt state (see isBlockTerminator()), before
+ * an undecodable word, or after MAX_INSTRUCTIONS instructions.
+ *
+ * A cached block fetched HOT_FETCHES times is translated: handlers gets the handler
+ * every instruction resolves to (see executors_::resolveExecutor()), so the dispatch
+ * loop calls it without going through the executor and operand tables again. Built with
+ * M68K_X86_64_JIT, runs of register-only instructions are also compiled to host code,
+ * see NativeSegment.
+ *
+ * Blocks ending in BRA, BSR, Bcc, DBcc or an absolute JMP, or running into the next
+ * block without a branch, know the addresses they may continue at. BlockCache links
+ * each of them to the block found there the first time execution goes that way, so
+ * CPU::run() moves from block to block of a hot loop without looking them up again.
+ */
+struct BasicBlock {
+    static constexpr size_t MAX_INSTRUCTIONS = 64;
+    static constexpr uint32_t HOT_FETCHES = 16;
+
+    uint32_t startPc{};
+    uint32_t endPc{};   ///< Address right after the last instruction
+    std::vector<PackedInstruction> instructions;
+    bool valid = true;  ///< Cleared when the block's code is overwritten; execution must leave the block
+    IdleLoopKind idleLoop = IdleLoopKind::NONE;
+    LoopIdiom loopIdiom = LoopIdiom::NONE;
+    uint32_t fetches = 0;
+    /// One per instruction once the block is translated, empty before
+    std::vector<executors_::ExecutorFunction> handlers;
+    /// One per instruction once native code is generated, empty before and without M68K_X86_64_JIT
+    std::vector<NativeSegment> nativeSegments;
+    /// Executable memory the segments' entries point into, released with the block
+    std::shared_ptr<const void> nativeCode;
+
+    struct Link {
+        uint32_t pc{};
+        BasicBlock* block = nullptr;    ///< Set on first use, cleared when either block is dropped
+    };
+
+    /// Static successors, taken branch first
+    std::array<Link, 2> successors{};
+    uint8_t successorsCount = 0;
+    /// Blocks with a link to this one
+    std::vector<BasicBlock*> predecessors;
+};
+
+/**
+ * @brief Instructions after which execution may not continue at the next address.
+ */
+[[nodiscard]] constexpr bool isBlockTerminator(InstructionType type)
+{
+    switch (type) {
+        case InstructionType::BRA:
+        case InstructionType::BSR:
+        case InstructionType::Bcc:
+        case InstructionType::DBcc:
+        case InstructionType::JMP:
+        case InstructionType::JSR:
+        case InstructionType::RTS:
+        case InstructionType::RTE:
+        case InstructionType::RTR:
+        case InstructionType::TRAP:
+        case InstructionType::TRAPV:
+        case InstructionType::CHK:
+        case InstructionType::ILLEGAL:
+        case InstructionType::STOP:
+        case InstructionType::RESET:
+        /// SR writes may switch stacks or unmask interrupts
+        case InstructionType::MOVE_to_SR:
+        case InstructionType::ANDI_to_SR:
+        case InstructionType::EORI_to_SR:
+        case InstructionType::ORI_to_SR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace m68k
@@ -0,0 +1,81 @@
+#pragma once
+#include <cpu/internal/instruction_decoder/basic_block.h>
+#include <cpu/internal/instruction_decoder/instruction_decoder.h>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <memoryinterface.h>
+#include <unordered_map>
+#include <vector>
+
+namespace m68k {
+
+/**
+ * @brief Basic blocks indexed by start PC.
+ *
+ * Blocks are built with InstructionDecoder::decodePacked() on the first fetch of their start PC.
+ * Like DecodeCache, only blocks made entirely of ROM or direct RAM instructions are kept;
+ * a block never extends into uncacheable memory. The cache registers itself on the bus
+ * as a code write listener and drops every block overlapping a written RAM page.
+ *
+ * Every fetch of a cached block counts towards translating it, see BasicBlock::HOT_FETCHES.
+ *
+ * A fetch continuing at a static successor of the previously fetched block follows
+ * that block's link, patched on the first such fetch, instead of the hash map. Once
+ * linked, CPU::run() goes from block to block with follow() and no fetch at all.
+ * Dropping a block unlinks it from both ends.
+ *
+ * Dropped blocks are marked invalid and kept alive until the next fetch(), so the block
+ * being executed stays readable after it overwrites its own code.
+ */
+class BlockCache : public DataExchange::CodeWriteListener {
+public:
+    BlockCache(std::shared_ptr<DataExchange::MemoryInterface> bus, InstructionDecoder& decoder);
+    BlockCache(const BlockCache&) = delete;
+    BlockCache(BlockCache&&) = delete;
+    BlockCache& operator=(const BlockCache&) = delete;
+    BlockCache& operator=(BlockCache&&) = delete;
+    ~BlockCache() override;
+
+    /**
+     * @brief Block starting at pc, built if not cached.
+     * @return The block, or the decode error of its first instruction. The reference stays
+     *         valid until the next call.
+     */
+    [[nodiscard]] std::expected<std::reference_wrapper<const BasicBlock>, DecodeError> fetch(uint32_t pc); //NOLINT(*-identifier-length)
+
+    /**
+     * @brief Block linked from block as its successor at pc, entered like a fetch().
+     * @return nullptr when pc is not one of block's static successors or the link is
+     *         not patched yet; fetch() patches it.
+     */
+    [[nodiscard]] const BasicBlock* follow(const BasicBlock& block, uint32_t pc); //NOLINT(*-identifier-length)
+
+    void onCodeWrite(uint32_t pageStart, uint32_t pageSize) override;
+
+    void clear();
+
+    [[nodiscard]] size_t size() const { return blocks_.size(); }
+
+private:
+    [[nodiscard]] std::expected<BasicBlock, DecodeError> build(uint32_t pc, bool& cacheable); //NOLINT(*-identifier-length)
+    void retire(std::unique_ptr<BasicBlock> block);
+    /// Return block from fetch(), counting the fetch and linking it from the previous block
+    std::reference_wrapper<const BasicBlock> enter(BasicBlock& block, uint32_t pc); //NOLINT(*-identifier-length)
+    void unlink(BasicBlock& block);
+
+private:
+    std::shared_ptr<DataExchange::MemoryInterface> bus_;
+    InstructionDecoder& decoder_;
+
+    std::unordered_map<uint32_t, std::unique_ptr<BasicBlock>> blocks_;
+    /// Invalidated blocks, freed on the next fetch()
+    std::vector<std::unique_ptr<BasicBlock>> retiredBlocks_;
+    /// Last block built outside the cache
+    std::unique_ptr<BasicBlock> uncachedBlock_;
+    /// Last cached block fetch() returned, the source of the next link
+    BasicBlock* previous_ = nullptr;
+};
+
+} // namespace m68k
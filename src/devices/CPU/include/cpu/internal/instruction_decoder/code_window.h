@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memoryinterface.h>
+#include <span>
+
+namespace m68k {
+
+/**
+ * @brief Memory the decoders read instruction words from.
+ *
+ * Serves reads inside the current window, a span of host-order words starting at an
+ * even address, from the span itself. Reads outside it, e.g. extension words past the
+ * end of a ROM buffer or a direct page, go to the fallback memory, or fail when there
+ * is none. Writes always go to the fallback.
+ */
+class CodeWindow : public DataExchange::MemoryInterface {
+public:
+    explicit CodeWindow(DataExchange::MemoryInterface* fallback) : fallback_(fallback) {}
+
+    void setWindow(std::span<const uint16_t> words, uint32_t startAddress)
+    {
+        words_ = words;
+        startAddress_ = startAddress;
+    }
+
+    void clearWindow() { words_ = {}; }
+
+    [[nodiscard]] std::expected<DataExchange::MemoryAccessResult, DataExchange::MemoryAccessError> read16(uint32_t address) const override
+    {
+        const uint32_t offset = (address & ~1U) - startAddress_;
+        if (offset / sizeof(uint16_t) < words_.size()) {
+            return DataExchange::MemoryAccessResult{.data = words_[offset / sizeof(uint16_t)], .waitCycles = 0};
+        }
+
+        if (fallback_ == nullptr) {
+            return std::unexpected(DataExchange::MemoryAccessError::READ_FROM_UNMAPPED_ADDRESS);
+        }
+        return fallback_->read16(address);
+    }
+
+    [[nodiscard]] std::expected<void, DataExchange::MemoryAccessError> write16(uint32_t address, uint16_t value) override
+    {
+        if (fallback_ == nullptr) {
+            return std::unexpected(DataExchange::MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
+        }
+        return fallback_->write16(address, value);
+    }
+
+private:
+    DataExchange::MemoryInterface* fallback_;
+    std::span<const uint16_t> words_;
+    uint32_t startAddress_ = 0;
+};
+
+} // namespace m68k
@@ -0,0 +1,61 @@
+#pragma once
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstddef>
+#include <cstdint>
+#include <memoryinterface.h>
+#include <vector>
+
+namespace m68k {
+
+/**
+ * @brief Direct-mapped cache of decoded instructions keyed by PC.
+ *
+ * Filled by InstructionDecoder::decodeCached() for instructions in ROM or direct RAM.
+ * Registered on the bus as the code write listener: the first write to a RAM page
+ * holding cached instructions drops every entry overlapping that page.
+ *
+ * Entries hold PackedInstruction records, so a lookup copies 24 bytes and a dropped
+ * entry is only retagged.
+ */
+class DecodeCache : public DataExchange::CodeWriteListener {
+public:
+    static constexpr size_t ENTRIES_COUNT = 4096;
+
+    DecodeCache();
+
+    /**
+     * @brief Cached result for pc, or nullptr.
+     */
+    [[nodiscard]] const PackedInstruction* find(uint32_t pc) const //NOLINT(*-identifier-length)
+    {
+        const auto& entry = entries_[indexOf(pc)];
+        return (entry.pc == pc) ? &entry.instruction : nullptr;
+    }
+
+    /**
+     * @brief Store instruction for pc, replacing whatever occupied its slot.
+     */
+    void insert(uint32_t pc, const PackedInstruction& instruction); //NOLINT(*-identifier-length)
+
+    void onCodeWrite(uint32_t pageStart, uint32_t pageSize) override;
+
+    void clear();
+
+private:
+    /// odd, so never equal to a valid instruction address
+    static constexpr uint32_t INVALID_PC = 0xFFFFFFFF;
+
+    struct Entry {
+        uint32_t pc = INVALID_PC; //NOLINT(*-identifier-length)
+        PackedInstruction instruction;
+    };
+
+    [[nodiscard]] static size_t indexOf(uint32_t pc) //NOLINT(*-identifier-length)
+    {
+        return (pc >> 1U) & (ENTRIES_COUNT - 1);
+    }
+
+    std::vector<Entry> entries_;
+};
+
+} // namespace m68k
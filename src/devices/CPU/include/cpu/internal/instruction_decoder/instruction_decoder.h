@@ -1,14 +1,18 @@
 #pragma once
+#include <cpu/internal/instruction_decoder/code_window.h>
+#include <cpu/internal/instruction_decoder/decode_cache.h>
 #include <cpu/internal/instruction_decoder/decode_result.h>
 #include <cpu/internal/instruction_decoder/decoders/base_decoder.h>
 #include <cpu/internal/instruction_decoder/instruction_decode_error.h>
 #include <cpu/internal/instruction_decoder/instruction_type_decoder.h>
 #include <cpu/internal/instructions/instruction.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <memory>
 #include <memoryinterface.h>
-#include <optional>
+#include <span>
 #include <vector>
 
 
@@ -16,16 +20,65 @@ namespace m68k {
 
 class InstructionDecoder {
 public:
+    /// Longest 68000 instruction: opcode plus four extension words, e.g. MOVE.L #imm,(xxx).L
+    static constexpr size_t MAX_INSTRUCTION_WORDS = 5;
+
+    /**
+     * @param bus Memory to decode from; may be null to decode only from caller-provided words.
+     */
     explicit InstructionDecoder(std::shared_ptr<DataExchange::MemoryInterface> bus);
+    InstructionDecoder(const InstructionDecoder&) = delete;
+    InstructionDecoder(InstructionDecoder&&) = delete;
+    InstructionDecoder& operator=(const InstructionDecoder&) = delete;
+    InstructionDecoder& operator=(InstructionDecoder&&) = delete;
+    ~InstructionDecoder();
+
+    /**
+     * @brief Decode the instruction at pc.
+     *
+     * The opcode and extension words are fetched at once from the bus's directly readable
+     * memory (see MemoryInterface::peekCodeWords()); words past its end are read through the bus.
+     */
     [[nodiscard]] std::expected<DecodeResult, DecodeError> decode(uint32_t pc); //NOLINT(*-identifier-length)
 
+    /**
+     * @brief Decode the instruction at pc from words, the code starting at pc.
+     *
+     * Only reads past the end of words go to the bus, so a ROM buffer can be decoded
+     * without one; they fail with MEMORY_READ_FAILURE when there is no bus.
+     */
+    [[nodiscard]] std::expected<DecodeResult, DecodeError> decode(std::span<const uint16_t> words, uint32_t pc); //NOLINT(*-identifier-length)
+
+    /**
+     * @brief Decode and pack the instruction at pc.
+     */
+    [[nodiscard]] std::expected<PackedInstruction, DecodeError> decodePacked(uint32_t pc); //NOLINT(*-identifier-length)
+
+    /**
+     * @brief Decode and pack the instruction at pc from words, see decode(std::span<const uint16_t>, uint32_t).
+     */
+    [[nodiscard]] std::expected<PackedInstruction, DecodeError> decodePacked(std::span<const uint16_t> words, uint32_t pc); //NOLINT(*-identifier-length)
+
+    /**
+     * @brief Decode through the decode cache.
+     *
+     * Instructions in ROM or direct RAM are served from the cache after their first decode;
+     * others are decoded every time.
+     */
+    [[nodiscard]] std::expected<PackedInstruction, DecodeError> decodeCached(uint32_t pc); //NOLINT(*-identifier-length)
+
 private:
     void initDecoders();
+    [[nodiscard]] std::expected<DecodeResult, DecodeError> decodeFromWindow(uint32_t pc); //NOLINT(*-identifier-length)
 private:
     std::shared_ptr<DataExchange::MemoryInterface> bus_;
+    /// What the decoders read from: the current instruction's words, backed by bus_
+    std::shared_ptr<CodeWindow> codeWindow_;
     std::unique_ptr<InstructionTypeDecoder> typeDecoder_;
 
     std::vector<std::unique_ptr<decoders_::IDecoder>> decoders_;
+
+    std::unique_ptr<DecodeCache> decodeCache_;
 };
 
 } // namespace m68k
\ No newline at end of file
@@ -2,16 +2,39 @@
 #include "instruction_decode_error.h"
 #include "opcodes_masks.h"
 #include <array>
+#include <bit>
 #include <cpu/internal/instructions/instruction_params.h>
 #include <expected>
+#include <optional>
 
 namespace m68k {
 
 class InstructionTypeDecoder
 {
 public:
+    /**
+     * @brief Resolve instruction type with a single lookup in the precomputed dispatch table.
+     */
     [[nodiscard]] std::expected<InstructionType, DecodeError> decode(uint16_t opcodeValue) const;
-    
+
+    /**
+     * @brief Reference resolver: linear scan over opcodeTable_.
+     *
+     * The most specific (largest popcount) matching mask wins; two different
+     * types matching with equally specific masks are reported as ambiguous.
+     * Used at compile time to build the dispatch table.
+     */
+    [[nodiscard]] static constexpr std::expected<InstructionType, DecodeError> resolve(uint16_t opcodeValue);
+
+    static constexpr size_t DISPATCH_TABLE_SIZE = 0x10000;
+
+    /// Dispatch table entry for opcodes that do not resolve to a single instruction type
+    static constexpr InstructionType INVALID_TYPE = InstructionType::INSTRUCTIONS_COUNT;
+
+    using DispatchTable = std::array<InstructionType, DISPATCH_TABLE_SIZE>;
+
+    [[nodiscard]] static constexpr DispatchTable buildDispatchTable();
+
 private:
     struct OpcodeInfo {
         uint16_t mask;
@@ -122,4 +145,81 @@ private:
     };
 };
 
+constexpr std::expected<InstructionType, DecodeError> InstructionTypeDecoder::resolve(uint16_t opcodeValue)
+{
+    std::optional<InstructionType> bestType;
+    int bestPopBitsCount = 0;
+
+    bool hasDuplicate = false;
+    for(const auto& candidate : opcodeTable_) {
+
+        if((opcodeValue & candidate.mask) != candidate.pattern) {
+            continue;
+        }
+
+        const auto popBitsCount = std::popcount(candidate.mask);
+
+        if(!bestType || popBitsCount > bestPopBitsCount) {
+            bestType = candidate.type;
+            bestPopBitsCount = popBitsCount;
+            hasDuplicate = false;
+        } else if (popBitsCount == bestPopBitsCount && bestType != candidate.type) {
+            hasDuplicate = true;
+        }
+
+    }
+
+    if(!bestType || hasDuplicate) {
+        return std::unexpected(DecodeError::INVALID_INSTRUCTION);
+    }
+
+    return *bestType;
+}
+
+constexpr InstructionTypeDecoder::DispatchTable InstructionTypeDecoder::buildDispatchTable()
+{
+    /**
+     * Instead of running resolve() for each of the 64K opcodes, every table entry "paints"
+     * only the opcodes it matches (all submasks of its don't-care bits). Entries are visited
+     * in opcodeTable_ order with the same tie-break rules, so the result is identical to resolve().
+     */
+    DispatchTable table{};
+    std::array<uint8_t, DISPATCH_TABLE_SIZE> bestPopBitsCount{};
+    std::array<bool, DISPATCH_TABLE_SIZE> hasDuplicate{};
+
+    table.fill(INVALID_TYPE);
+
+    for(const auto& candidate : opcodeTable_) {
+
+        const auto popBitsCount = static_cast<uint8_t>(std::popcount(candidate.mask));
+        const auto freeBits = static_cast<uint16_t>(~candidate.mask);
+
+        uint16_t subset = freeBits;
+        while(true) {
+            const auto opcode = static_cast<uint16_t>(candidate.pattern | subset);
+
+            if(table[opcode] == INVALID_TYPE || popBitsCount > bestPopBitsCount[opcode]) { //NOLINT(*-constant-array-index)
+                table[opcode] = candidate.type; //NOLINT(*-constant-array-index)
+                bestPopBitsCount[opcode] = popBitsCount; //NOLINT(*-constant-array-index)
+                hasDuplicate[opcode] = false; //NOLINT(*-constant-array-index)
+            } else if(popBitsCount == bestPopBitsCount[opcode] && table[opcode] != candidate.type) { //NOLINT(*-constant-array-index)
+                hasDuplicate[opcode] = true; //NOLINT(*-constant-array-index)
+            }
+
+            if(subset == 0) {
+                break;
+            }
+            subset = static_cast<uint16_t>((subset - 1U) & freeBits);
+        }
+    }
+
+    for(size_t opcode = 0; opcode < DISPATCH_TABLE_SIZE; ++opcode) {
+        if(hasDuplicate[opcode]) { //NOLINT(*-constant-array-index)
+            table[opcode] = INVALID_TYPE; //NOLINT(*-constant-array-index)
+        }
+    }
+
+    return table;
+}
+
 } // namespace m68k
\ No newline at end of file
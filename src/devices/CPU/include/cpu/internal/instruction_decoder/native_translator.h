@@ -0,0 +1,32 @@
+#pragma once
+#include <cpu/internal/instruction_decoder/basic_block.h>
+
+/**
+ * @file native_translator.h
+ * @brief x86-64 code generation for translated blocks, built with M68K_X86_64_JIT.
+ *
+ * Runs of at least MIN_NATIVE_INSTRUCTIONS register-only instructions (NOP, MOVEQ and
+ * MOVE from a data register or an immediate to a data register) become one host
+ * function. The data registers the run uses are loaded into host registers once, the
+ * instructions work on those, and the written ones are stored back on return. Condition
+ * codes are left to the host: only the last flag-setting instruction is followed by a
+ * TEST, and N and Z are read from EFLAGS.
+ *
+ * Everything else keeps going through BasicBlock::handlers, so LockstepValidator checks
+ * the native code against the interpreter like any other translated block.
+ */
+
+namespace m68k {
+
+/// Shorter runs are cheaper through their handlers than through a call to host code
+inline constexpr size_t MIN_NATIVE_INSTRUCTIONS = 2;
+
+/**
+ * @brief Fill block.nativeSegments and block.nativeCode for the block's register-only runs.
+ *
+ * Leaves the block as it is when it has no such run or executable memory cannot be
+ * allocated.
+ */
+void translateNative(BasicBlock& block);
+
+} // namespace m68k
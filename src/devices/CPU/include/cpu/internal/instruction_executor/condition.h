@@ -0,0 +1,34 @@
+#pragma once
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/registers.h>
+
+namespace m68k::executors_ {
+
+/**
+ * @brief Evaluate a Bcc/DBcc/Scc condition against the condition codes.
+ */
+[[nodiscard]] constexpr bool testCondition(Condition condition, const m68k_::StatusRegister& sr)
+{
+    switch (condition) {
+        case Condition::TRUE:               return true;
+        case Condition::FALSE:              return false;
+        case Condition::HIGH:               return !sr.carry() && !sr.zero();
+        case Condition::LOW_OR_SAME:        return sr.carry() || sr.zero();
+        case Condition::CARRY_CLEAR:        return !sr.carry();
+        case Condition::CARRY_SET:          return sr.carry();
+        case Condition::NOT_EQUAL:          return !sr.zero();
+        case Condition::EQUAL:              return sr.zero();
+        case Condition::OVERFLOW_CLEAR:     return !sr.overflow();
+        case Condition::OVERFLOW_SET:       return sr.overflow();
+        case Condition::PLUS:               return !sr.negative();
+        case Condition::MINUS:              return sr.negative();
+        case Condition::GREATER_OR_EQUAL:   return sr.negative() == sr.overflow();
+        case Condition::LESS_THAN:          return sr.negative() != sr.overflow();
+        case Condition::GREATER_THAN:       return !sr.zero() && (sr.negative() == sr.overflow());
+        case Condition::LESS_OR_EQUAL:      return sr.zero() || (sr.negative() != sr.overflow());
+    }
+
+    return false;
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,156 @@
+#pragma once
+#include <cpu/internal/bus_helper/bus_helper.h>
+#include <cpu/internal/instruction_executor/execution_context.h>
+#include <cpu/internal/instruction_executor/instruction_execute_error.h>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstdint>
+#include <expected>
+#include <type_traits>
+
+/**
+ * @file effective_address.h
+ * @brief Operand access for executors, specialized on operand size and addressing mode.
+ *
+ * Size and mode are template parameters, so an executor instantiated for one
+ * (size, mode) pair reads and writes its operands without any runtime switch.
+ * Memory faults are reported the way ExecutionContext describes: ADDRESS_ERROR for
+ * odd word/long addresses, a memory failure otherwise, with faultAddress set.
+ */
+
+namespace m68k::executors_ {
+
+template <OperationSize Size>
+using Operand = std::conditional_t<Size == OperationSize::BYTE, uint8_t,
+                std::conditional_t<Size == OperationSize::WORD, uint16_t, uint32_t>>;
+
+/// Bytes moved by (An)+ and -(An); A7 stays word aligned for byte operands
+template <OperationSize Size>
+[[nodiscard]] constexpr uint32_t addressStep(uint8_t addressRegister)
+{
+    if constexpr (Size == OperationSize::BYTE) {
+        return addressRegister == 7 ? 2 : 1; //NOLINT(*-magic-numbers)
+    } else {
+        return sizeof(Operand<Size>);
+    }
+}
+
+template <AddressingMode Mode>
+inline constexpr bool isMemoryMode = Mode != AddressingMode::NONE && Mode != AddressingMode::DATA_REGISTER &&
+                                     Mode != AddressingMode::ADDRESS_REGISTER && Mode != AddressingMode::IMMEDIATE;
+
+/**
+ * @brief Address of a memory operand, applying (An)+ and -(An).
+ * @param extensionPc Address of the operand's extension word, the base of PC-relative modes
+ */
+template <AddressingMode Mode, OperationSize Size>
+requires isMemoryMode<Mode>
+[[nodiscard]] inline uint32_t effectiveAddress(ExecutionContext& context, const PackedEffectiveAddress& ea, uint32_t extensionPc)
+{
+    auto& regs = context.regs;
+    if constexpr (Mode == AddressingMode::ADDRESS) {
+        return regs.A(ea.reg);
+    } else if constexpr (Mode == AddressingMode::ADDRESS_WITH_POSTINCREMENT) {
+        const uint32_t address = regs.A(ea.reg);
+        regs.A(ea.reg) = address + addressStep<Size>(ea.reg);
+        return address;
+    } else if constexpr (Mode == AddressingMode::ADDRESS_WITH_PREDECREMENT) {
+        regs.A(ea.reg) -= addressStep<Size>(ea.reg);
+        return regs.A(ea.reg);
+    } else if constexpr (Mode == AddressingMode::ADDRESS_WITH_DISPLACEMENT) {
+        return regs.A(ea.reg) + ea.extension();
+    } else if constexpr (Mode == AddressingMode::PC_WITH_DISPLACEMENT) {
+        return extensionPc + ea.extension();
+    } else if constexpr (Mode == AddressingMode::ADDRESS_WITH_INDEX || Mode == AddressingMode::PC_WITH_INDEX) {
+        const uint32_t base = Mode == AddressingMode::ADDRESS_WITH_INDEX ? regs.A(ea.reg) : extensionPc;
+        const uint32_t indexRegister = regs.R(ea.indexRegisterField());
+        const uint32_t index = ea.indexIsLong() ? indexRegister : static_cast<uint32_t>(static_cast<int16_t>(indexRegister));
+        return base + static_cast<uint32_t>(ea.indexDisplacement()) + index;
+    } else {
+        /// absolute short is sign-extended when packed
+        return ea.extension();
+    }
+}
+
+template <OperationSize Size>
+[[nodiscard]] inline std::expected<Operand<Size>, ExecuteError> readMemory(ExecutionContext& context, uint32_t address)
+{
+    if constexpr (Size != OperationSize::BYTE) {
+        if ((address & 1U) != 0) [[unlikely]] {
+            context.faultAddress = address;
+            return std::unexpected(ExecuteError::ADDRESS_ERROR);
+        }
+    }
+
+    const auto result = busHelper::read<Operand<Size>>(context.bus, address);
+    if (!result) [[unlikely]] {
+        context.faultAddress = address;
+        return std::unexpected(ExecuteError::MEMORY_READ_FAILURE);
+    }
+    return result->data;
+}
+
+template <OperationSize Size>
+[[nodiscard]] inline std::expected<void, ExecuteError> writeMemory(ExecutionContext& context, uint32_t address, Operand<Size> value)
+{
+    if constexpr (Size != OperationSize::BYTE) {
+        if ((address & 1U) != 0) [[unlikely]] {
+            context.faultAddress = address;
+            context.faultOnWrite = true;
+            return std::unexpected(ExecuteError::ADDRESS_ERROR);
+        }
+    }
+
+    if (!busHelper::write<Operand<Size>>(context.bus, address, value)) [[unlikely]] {
+        context.faultAddress = address;
+        return std::unexpected(ExecuteError::MEMORY_WRITE_FAILURE);
+    }
+    return {};
+}
+
+/// Write the low bytes of a data register, keeping the rest
+template <OperationSize Size>
+inline void writeDataRegister(m68k_::Registers& regs, uint8_t reg, Operand<Size> value)
+{
+    if constexpr (Size == OperationSize::LONG) {
+        regs.D(reg) = value;
+    } else {
+        constexpr uint32_t mask = static_cast<Operand<Size>>(~0U);
+        regs.D(reg) = (regs.D(reg) & ~mask) | value;
+    }
+}
+
+/**
+ * @brief Read a source operand.
+ * @param extensionPc Address of the operand's extension word, the base of PC-relative modes
+ */
+template <AddressingMode Mode, OperationSize Size>
+[[nodiscard]] inline std::expected<Operand<Size>, ExecuteError> readOperand(ExecutionContext& context, const PackedEffectiveAddress& ea,
+                                                                            uint32_t extensionPc)
+{
+    if constexpr (Mode == AddressingMode::DATA_REGISTER) {
+        return static_cast<Operand<Size>>(context.regs.D(ea.reg));
+    } else if constexpr (Mode == AddressingMode::ADDRESS_REGISTER) {
+        return static_cast<Operand<Size>>(context.regs.A(ea.reg));
+    } else if constexpr (Mode == AddressingMode::IMMEDIATE) {
+        return static_cast<Operand<Size>>(ea.extension());
+    } else {
+        return readMemory<Size>(context, effectiveAddress<Mode, Size>(context, ea, extensionPc));
+    }
+}
+
+/// Write a destination operand; data alterable modes only
+template <AddressingMode Mode, OperationSize Size>
+requires (Mode == AddressingMode::DATA_REGISTER || (isMemoryMode<Mode> && Mode != AddressingMode::PC_WITH_DISPLACEMENT &&
+                                                    Mode != AddressingMode::PC_WITH_INDEX))
+[[nodiscard]] inline std::expected<void, ExecuteError> writeOperand(ExecutionContext& context, const PackedEffectiveAddress& ea, Operand<Size> value)
+{
+    if constexpr (Mode == AddressingMode::DATA_REGISTER) {
+        writeDataRegister<Size>(context.regs, ea.reg, value);
+        return {};
+    } else {
+        return writeMemory<Size>(context, effectiveAddress<Mode, Size>(context, ea, 0), value);
+    }
+}
+
+} //namespace m68k::executors_
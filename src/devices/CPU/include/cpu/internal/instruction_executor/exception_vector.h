@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+namespace m68k {
+
+/// 68000 exception vector numbers; the vector is read from address number * 4
+enum class ExceptionVector : uint8_t {
+    RESET_SSP = 0,
+    RESET_PC = 1,
+    BUS_ERROR = 2,
+    ADDRESS_ERROR = 3,
+    ILLEGAL_INSTRUCTION = 4,
+    ZERO_DIVIDE = 5,
+    CHK = 6,
+    TRAPV = 7,
+    PRIVILEGE_VIOLATION = 8,
+    TRACE = 9,
+    LINE_A = 10,
+    LINE_F = 11,
+    SPURIOUS_INTERRUPT = 24,
+    LEVEL_1_AUTOVECTOR = 25,
+    TRAP_0 = 32
+};
+
+} //namespace m68k
@@ -0,0 +1,48 @@
+#pragma once
+#include <cpu/internal/instruction_executor/exception_vector.h>
+#include <cpu/internal/instruction_executor/instruction_execute_error.h>
+#include <cpu/internal/instruction_executor/lazy_flags.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <expected>
+#include <memoryinterface.h>
+
+namespace m68k::executors_ {
+
+/**
+ * @brief State an executor works on.
+ *
+ * PC already points past the executed instruction; instructionPc is its start
+ * address, the base for branch displacements. Executors of instructions whose time
+ * depends on their operands add the difference to the packed time in extraCycles.
+ * Condition codes go through flags; the CCR bits of regs.SR() are only current after
+ * flags.materialize().
+ *
+ * Executors report 68000 exceptions as errors: ExecuteError::EXCEPTION with exceptionVector
+ * set, or a memory failure / ADDRESS_ERROR with faultAddress set. The CPU then runs the
+ * exception processing.
+ */
+struct ExecutionContext {
+    m68k_::Registers& regs;
+    DataExchange::MemoryInterface& bus;
+    LazyFlags& flags;
+    uint32_t instructionPc;
+    int32_t extraCycles = 0;
+    /// Set by executors that write SR, pending interrupts are checked again after them
+    bool statusRegisterWritten = false;
+    /// Set by STOP together with statusRegisterWritten: the CPU idles until an interrupt
+    bool stopped = false;
+    ExceptionVector exceptionVector = ExceptionVector::ILLEGAL_INSTRUCTION;
+    uint32_t faultAddress = 0;
+    /// The faulted access was a write, for address errors
+    bool faultOnWrite = false;
+};
+
+/// Report a 68000 exception from an executor: `return raiseException(context, ExceptionVector::CHK);`
+inline std::unexpected<ExecuteError> raiseException(ExecutionContext& context, ExceptionVector vector)
+{
+    context.exceptionVector = vector;
+    return std::unexpected(ExecuteError::EXCEPTION);
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,32 @@
+#pragma once
+#include <cpu/internal/instruction_executor/execution_context.h>
+#include <cpu/internal/instruction_executor/instruction_execute_error.h>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <expected>
+
+namespace m68k::executors_ {
+
+/**
+ * @brief Executor of one instruction type.
+ *
+ * Implemented instructions provide an explicit specialization declared in
+ * executors/<Name>_executor.h. The primary template returns
+ * ExecuteError::UNIMPLEMENTED_INSTRUCTION.
+ */
+template <InstructionType Type>
+std::expected<void, ExecuteError> execute(ExecutionContext& context, const PackedInstruction& instruction);
+
+using ExecutorFunction = std::expected<void, ExecuteError> (*)(ExecutionContext&, const PackedInstruction&);
+
+/**
+ * @brief Handler that execute<Type>() ends up calling for this decoded instruction.
+ *
+ * Executors with a second dispatch level (see operand_dispatch.h) specialize it to
+ * return the handler generated for the instruction's operands. The primary template
+ * returns execute<Type> itself.
+ */
+template <InstructionType Type>
+ExecutorFunction resolve(const PackedInstruction& instruction);
+
+} //namespace m68k::executors_
@@ -0,0 +1,33 @@
+#pragma once
+#include <cpu/internal/instruction_executor/execution_context.h>
+#include <cpu/internal/instruction_executor/executor.h>
+#include <cpu/internal/instruction_executor/instruction_execute_error.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <expected>
+
+/**
+ * @file executor_table.h
+ * @brief Dispatch of decoded instructions to their executors.
+ *
+ * Every implemented instruction has a specialization
+ * `execute<InstructionType::<Name>>(ExecutionContext&, const PackedInstruction&)`
+ * declared in executors/<Name>_executor.h. executeInstruction() selects it through a
+ * constexpr table of function pointers indexed by the packed instruction's type, so each
+ * instruction reaches its handler in one indirect call. Instructions without a
+ * specialization resolve to the primary template, which returns
+ * ExecuteError::UNIMPLEMENTED_INSTRUCTION.
+ *
+ * Executors whose code depends on operand size and addressing modes add a second level,
+ * a table of handlers generated per (size, source mode, destination mode), see
+ * operand_dispatch.h. resolveExecutor() looks both levels up ahead of time, for
+ * blocks executed often enough to be translated (see BasicBlock::handlers).
+ */
+
+namespace m68k::executors_ {
+
+[[nodiscard]] std::expected<void, ExecuteError> executeInstruction(ExecutionContext& context, const PackedInstruction& instruction);
+
+/// The handler executeInstruction() calls for this instruction, which does the same
+[[nodiscard]] ExecutorFunction resolveExecutor(const PackedInstruction& instruction);
+
+} //namespace m68k::executors_
@@ -0,0 +1,9 @@
+#pragma once
+#include <cpu/internal/instruction_executor/executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::DBcc>(ExecutionContext& context, const PackedInstruction& instruction);
+
+} //namespace m68k::executors_
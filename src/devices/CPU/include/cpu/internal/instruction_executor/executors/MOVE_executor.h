@@ -0,0 +1,12 @@
+#pragma once
+#include <cpu/internal/instruction_executor/executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::MOVE>(ExecutionContext& context, const PackedInstruction& instruction);
+
+template <>
+ExecutorFunction resolve<InstructionType::MOVE>(const PackedInstruction& instruction);
+
+} //namespace m68k::executors_
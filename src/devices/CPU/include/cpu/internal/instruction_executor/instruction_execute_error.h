@@ -6,7 +6,11 @@ namespace m68k {
 enum class ExecuteError : uint8_t {
     MEMORY_READ_FAILURE,
     INVALID_INSTRUCTION,
-    INVALID_OPERATION_SIZE
+    INVALID_OPERATION_SIZE,
+    UNIMPLEMENTED_INSTRUCTION,
+    MEMORY_WRITE_FAILURE,
+    ADDRESS_ERROR,
+    EXCEPTION                   ///< Instruction raised ExecutionContext::exceptionVector
 };
 
 } //namespace m68k
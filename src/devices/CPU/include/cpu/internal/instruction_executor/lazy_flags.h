@@ -0,0 +1,116 @@
+#pragma once
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+
+namespace m68k::executors_ {
+
+/**
+ * @brief Condition codes of the last flag-setting operation, computed when read.
+ *
+ * Most results are overwritten by the next instruction before anything tests them, so
+ * ALU executors only record the operation, its size, operands and result. The X/N/Z/V/C
+ * bits of SR are brought up to date by materialize(), which whoever reads or writes the
+ * condition codes calls first: conditions (Bcc, DBcc, Scc), SR/CCR reads and writes,
+ * X-using instructions (ADDX, SUBX, ABCD, ...) and exception processing.
+ */
+class LazyFlags {
+public:
+    enum class Operation : uint8_t {
+        NONE,       ///< SR holds the current condition codes
+        LOGIC,      ///< N and Z from the result, V and C cleared, X unchanged
+        ADD,        ///< destination + source, X set like C
+        SUB,        ///< destination - source, X set like C
+        COMPARE     ///< destination - source, X unchanged
+    };
+
+    void setLogic(OperationSize size, uint32_t result)
+    {
+        record(Operation::LOGIC, size, 0, 0, result);
+    }
+
+    void setAdd(OperationSize size, uint32_t source, uint32_t destination, uint32_t result)
+    {
+        record(Operation::ADD, size, source, destination, result);
+    }
+
+    void setSub(OperationSize size, uint32_t source, uint32_t destination, uint32_t result)
+    {
+        record(Operation::SUB, size, source, destination, result);
+    }
+
+    void setCompare(OperationSize size, uint32_t source, uint32_t destination, uint32_t result)
+    {
+        record(Operation::COMPARE, size, source, destination, result);
+    }
+
+    [[nodiscard]] bool pending() const { return operation_ != Operation::NONE; }
+
+    /**
+     * @brief Write the pending condition codes into sr.
+     * @return sr, for evaluating a condition right away.
+     */
+    const m68k_::StatusRegister& materialize(m68k_::StatusRegister& sr)
+    {
+        if (operation_ != Operation::NONE) {
+            computeFlags(sr);
+            operation_ = Operation::NONE;
+        }
+        return sr;
+    }
+
+private:
+    void record(Operation operation, OperationSize size, uint32_t source, uint32_t destination, uint32_t result)
+    {
+        operation_ = operation;
+        size_ = size;
+        source_ = source;
+        destination_ = destination;
+        result_ = result;
+    }
+
+    void computeFlags(m68k_::StatusRegister& sr) const
+    {
+        //NOLINTBEGIN(*-magic-numbers)
+        const uint32_t signBit = size_ == OperationSize::BYTE ? 0x80U : size_ == OperationSize::WORD ? 0x8000U : 0x80000000U;
+        const uint32_t mask = (signBit << 1U) - 1U;
+        //NOLINTEND(*-magic-numbers)
+
+        using m68k_::StatusRegister;
+        uint16_t flags = 0;
+        flags |= (result_ & signBit) != 0 ? StatusRegister::NEGATIVE_BIT : 0U;
+        flags |= (result_ & mask) == 0 ? StatusRegister::ZERO_BIT : 0U;
+
+        bool overflow = false;
+        bool carry = false;
+        switch (operation_) {
+        case Operation::NONE:
+        case Operation::LOGIC:
+            break;
+        case Operation::ADD:
+            overflow = ((source_ ^ result_) & (destination_ ^ result_) & signBit) != 0;
+            carry = (((source_ & destination_) | (~result_ & (source_ | destination_))) & signBit) != 0;
+            break;
+        case Operation::SUB:
+        case Operation::COMPARE:
+            overflow = ((source_ ^ destination_) & (result_ ^ destination_) & signBit) != 0;
+            carry = (((source_ & ~destination_) | (result_ & ~destination_) | (source_ & result_)) & signBit) != 0;
+            break;
+        }
+        flags |= overflow ? StatusRegister::OVERFLOW_BIT : 0U;
+        flags |= carry ? StatusRegister::CARRY_BIT | StatusRegister::EXTEND_BIT : 0U;
+
+        /// X is only written by operations that set it like C
+        const bool setsExtend = operation_ == Operation::ADD || operation_ == Operation::SUB;
+        sr.setConditionCodes(flags, setsExtend ? StatusRegister::CONDITION_CODES
+                                               : StatusRegister::CONDITION_CODES & ~StatusRegister::EXTEND_BIT);
+    }
+
+    Operation operation_ = Operation::NONE;
+    OperationSize size_ = OperationSize::LONG;
+    uint32_t source_ = 0;
+    uint32_t destination_ = 0;
+    uint32_t result_ = 0;
+};
+
+} //namespace m68k::executors_
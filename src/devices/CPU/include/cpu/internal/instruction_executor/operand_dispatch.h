@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <cpu/internal/instruction_executor/execution_context.h>
+#include <cpu/internal/instruction_executor/executor.h>
+#include <cpu/internal/instruction_executor/instruction_execute_error.h>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstddef>
+#include <expected>
+#include <utility>
+
+/**
+ * @file operand_dispatch.h
+ * @brief Per (size, source mode, destination mode) handlers of one instruction type.
+ *
+ * An executor with size or addressing mode dependent code writes it once as
+ * `Handler<Size, Source, Destination>::execute()` and dispatches through
+ * makeOperandTable<Handler>(): every combination is instantiated at compile time into
+ * a straight-line handler, and the packed instruction's size and modes index the table.
+ * Single-operand instructions use their mode as Source and AddressingMode::NONE as
+ * Destination. Handlers reject illegal combinations with `if constexpr`, so they cost
+ * one instantiation each and no code at run time.
+ */
+
+namespace m68k::executors_ {
+
+inline constexpr size_t OPERATION_SIZES_COUNT = static_cast<size_t>(OperationSize::LONG) + 1;
+inline constexpr size_t ADDRESSING_MODES_COUNT = static_cast<size_t>(AddressingMode::IMMEDIATE) + 1;
+inline constexpr size_t OPERAND_TABLE_SIZE = OPERATION_SIZES_COUNT * ADDRESSING_MODES_COUNT * ADDRESSING_MODES_COUNT;
+
+[[nodiscard]] constexpr size_t operandIndex(OperationSize size, AddressingMode source, AddressingMode destination)
+{
+    return (static_cast<size_t>(size) * ADDRESSING_MODES_COUNT + static_cast<size_t>(source)) * ADDRESSING_MODES_COUNT +
+           static_cast<size_t>(destination);
+}
+
+template <template <OperationSize, AddressingMode, AddressingMode> class Handler>
+constexpr std::array<ExecutorFunction, OPERAND_TABLE_SIZE> makeOperandTable()
+{
+    return []<size_t... Indexes>(std::index_sequence<Indexes...> /*indexes*/) {
+        return std::array<ExecutorFunction, OPERAND_TABLE_SIZE>{
+            &Handler<static_cast<OperationSize>(Indexes / (ADDRESSING_MODES_COUNT * ADDRESSING_MODES_COUNT)),
+                     static_cast<AddressingMode>(Indexes / ADDRESSING_MODES_COUNT % ADDRESSING_MODES_COUNT),
+                     static_cast<AddressingMode>(Indexes % ADDRESSING_MODES_COUNT)>::execute...};
+    }(std::make_index_sequence<OPERAND_TABLE_SIZE>{});
+}
+
+/// Handler generated for the instruction's size and operand modes
+[[nodiscard]] inline ExecutorFunction resolveOperands(const std::array<ExecutorFunction, OPERAND_TABLE_SIZE>& table,
+                                                      const PackedInstruction& instruction)
+{
+    const size_t index = operandIndex(instruction.size, instruction.ea.mode, instruction.destinationEa.mode);
+    return table[index]; //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+/// Call the handler generated for the instruction's size and operand modes
+[[nodiscard]] inline std::expected<void, ExecuteError> dispatchOperands(const std::array<ExecutorFunction, OPERAND_TABLE_SIZE>& table,
+                                                                        ExecutionContext& context, const PackedInstruction& instruction)
+{
+    return resolveOperands(table, instruction)(context, instruction);
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,14 @@
+#pragma once
+#include <cpu/internal/registers.h>
+#include <cstdint>
+
+namespace m68k::executors_ {
+
+/// Load SR from its 16-bit layout, banking the stack pointers on an S change; unimplemented bits are ignored
+inline void setStatusRegisterWord(m68k_::Registers& regs, uint16_t word)
+{
+    regs.setSupervisorState((word & m68k_::StatusRegister::SUPERVISOR_OR_USER_STATE) != 0);
+    regs.SR().setWord(word);
+}
+
+} //namespace m68k::executors_
@@ -21,6 +21,11 @@ public:
         return type_;
     }
 
+    [[nodiscard]] const InstructionData::InstructionDataVariant& dataVariant() const
+    {
+        return data_;
+    }
+
     //NOLINTBEGIN (*-explicit-constructor)
     Instruction(const InstructionData::ABCD_InstructionData& data);
     Instruction(const InstructionData::ADD_InstructionData& data);
@@ -0,0 +1,384 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 68000 instruction timing, in clock cycles, as listed in the M68000 User's Manual (section 8).
+ *
+ * The static part of an instruction's time is computed once by instructionCycles() when the
+ * instruction is packed and stored in PackedInstruction::cycles, so the execute loop reads it
+ * together with the rest of the record. Time that depends on operand values (MULU/MULS,
+ * DIVU/DIVS, register counted shifts, branch outcome) is added by the executor through
+ * ExecutionContext::extraCycles using the helpers below.
+ *
+ * Bus wait states are not included.
+ */
+
+//NOLINTBEGIN(*-magic-numbers)
+namespace m68k::timing {
+
+constexpr size_t ADDRESSING_MODES_COUNT = static_cast<size_t>(AddressingMode::IMMEDIATE) + 1;
+
+/// One entry per AddressingMode, in declaration order
+using ModeTable = std::array<uint8_t, ADDRESSING_MODES_COUNT>;
+
+/// Effective address calculation time of byte and word operands
+///                             NONE Dn An (An) (An)+ -(An) d16(An) d8(An,Xn) d16(PC) d8(PC,Xn) xxx.W xxx.L #
+constexpr ModeTable EA_CYCLES      {0,   0, 0,  4,   4,    6,    8,      10,       8,      10,       8,    12,   4};
+/// Effective address calculation time of long operands
+constexpr ModeTable EA_CYCLES_LONG {0,   0, 0,  8,   8,    10,   12,     14,       12,     14,       12,   16,   8};
+
+/// MOVE destinations: -(An) costs the same as (An)
+constexpr ModeTable MOVE_DESTINATION_CYCLES      {0, 0, 0, 4, 4, 4, 8,  10, 8,  10, 8,  12, 0};
+constexpr ModeTable MOVE_DESTINATION_CYCLES_LONG {0, 0, 0, 8, 8, 8, 12, 14, 12, 14, 12, 16, 0};
+
+/// Control addressing instructions, address calculation included
+constexpr ModeTable LEA_CYCLES {0, 0, 0, 4,  0, 0, 8,  12, 8,  12, 8,  12, 0};
+constexpr ModeTable PEA_CYCLES {0, 0, 0, 12, 0, 0, 16, 20, 16, 20, 16, 20, 0};
+constexpr ModeTable JMP_CYCLES {0, 0, 0, 8,  0, 0, 10, 14, 10, 14, 10, 12, 0};
+constexpr ModeTable JSR_CYCLES {0, 0, 0, 16, 0, 0, 18, 22, 18, 22, 18, 20, 0};
+/// MOVEM address calculation, on top of its base and per register time
+constexpr ModeTable MOVEM_EA_CYCLES {0, 0, 0, 0, 0, 0, 4, 6, 4, 6, 4, 8, 0};
+
+/**
+ * @brief Base time of an instruction, effective address calculation excluded.
+ *
+ * The register columns apply when the instruction operates on a register (Dn, An or
+ * no operand at all), the memory columns when its destination or only operand is in memory.
+ */
+struct BaseCycles {
+    uint8_t registerWord = 0;
+    uint8_t registerLong = 0;
+    uint8_t memoryWord = 0;
+    uint8_t memoryLong = 0;
+};
+
+constexpr BaseCycles same(uint8_t cycles)
+{
+    return {cycles, cycles, cycles, cycles};
+}
+
+constexpr size_t INSTRUCTION_TYPES_COUNT = static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT);
+
+/// Indexed by InstructionType. Entries of instructions timed by instructionCycles() itself are 0.
+constexpr std::array<BaseCycles, INSTRUCTION_TYPES_COUNT> BASE_CYCLES = [] {
+    std::array<BaseCycles, INSTRUCTION_TYPES_COUNT> table{};
+    auto set = [&table](InstructionType type, BaseCycles cycles) { table[static_cast<size_t>(type)] = cycles; };
+
+    for (auto type : {InstructionType::ORI_to_CCR, InstructionType::ORI_to_SR, InstructionType::ANDI_to_CCR,
+                      InstructionType::ANDI_to_SR, InstructionType::EORI_to_CCR, InstructionType::EORI_to_SR}) {
+        set(type, same(20));
+    }
+    for (auto type : {InstructionType::ORI, InstructionType::ANDI, InstructionType::SUBI, InstructionType::ADDI, InstructionType::EORI}) {
+        set(type, {8, 16, 12, 20});
+    }
+    set(InstructionType::CMPI, {8, 14, 8, 12});
+
+    /// bit instructions on Dn are long, on memory byte; register times are the bit 16-31 worst case
+    set(InstructionType::BTST_IMMEDIATE, {10, 10, 8, 8});
+    set(InstructionType::BTST_REGISTER, {6, 6, 4, 4});
+    set(InstructionType::BCHG_IMMEDIATE, same(12));
+    set(InstructionType::BCHG_REGISTER, same(8));
+    set(InstructionType::BCLR_IMMEDIATE, {14, 14, 12, 12});
+    set(InstructionType::BCLR_REGISTER, {10, 10, 8, 8});
+    set(InstructionType::BSET_IMMEDIATE, same(12));
+    set(InstructionType::BSET_REGISTER, same(8));
+
+    set(InstructionType::MOVE_from_SR, {6, 6, 8, 8});
+    set(InstructionType::MOVE_to_CCR, same(12));
+    set(InstructionType::MOVE_to_SR, same(12));
+
+    for (auto type : {InstructionType::NEGX, InstructionType::CLR, InstructionType::NEG, InstructionType::NOT}) {
+        set(type, {4, 6, 8, 12});
+    }
+    set(InstructionType::EXT, same(4));
+    set(InstructionType::NBCD, {6, 6, 8, 8});
+    set(InstructionType::SWAP, same(4));
+    set(InstructionType::ILLEGAL, same(34));
+    set(InstructionType::TAS, {4, 4, 10, 10});
+    set(InstructionType::TST, same(4));
+    set(InstructionType::TRAP, same(34));
+    set(InstructionType::LINK, same(16));
+    set(InstructionType::UNLK, same(12));
+    set(InstructionType::MOVE_USP, same(4));
+    set(InstructionType::RESET, same(132));
+    set(InstructionType::NOP, same(4));
+    set(InstructionType::STOP, same(4));
+    set(InstructionType::RTE, same(20));
+    set(InstructionType::RTS, same(16));
+    set(InstructionType::TRAPV, same(4));
+    set(InstructionType::RTR, same(20));
+    set(InstructionType::CHK, same(10));
+
+    /// ADDQ/SUBQ to An always operate on the whole register, see instructionCycles()
+    set(InstructionType::ADDQ, {4, 8, 8, 12});
+    set(InstructionType::SUBQ, {4, 8, 8, 12});
+    /// condition false; a true condition on Dn adds SCC_TRUE_EXTRA_CYCLES
+    set(InstructionType::Scc, {4, 4, 8, 8});
+    /// branch taken; see the *_EXTRA_CYCLES helpers for the other outcomes
+    set(InstructionType::DBcc, same(10));
+    set(InstructionType::BRA, same(10));
+    set(InstructionType::BSR, same(18));
+    set(InstructionType::Bcc, same(10));
+    set(InstructionType::MOVEQ, same(4));
+
+    /// DIVU/DIVS depend entirely on their operands, executors add divuCycles()/divsCycles()
+    set(InstructionType::DIVU, same(0));
+    set(InstructionType::DIVS, same(0));
+    /// plus muluExtraCycles()/mulsExtraCycles()
+    set(InstructionType::MULU, same(38));
+    set(InstructionType::MULS, same(38));
+
+    /// memory columns are the -(Ay),-(Ax) forms
+    set(InstructionType::ABCD, {6, 6, 18, 18});
+    set(InstructionType::SBCD, {6, 6, 18, 18});
+    set(InstructionType::ADDX, {4, 8, 18, 30});
+    set(InstructionType::SUBX, {4, 8, 18, 30});
+    set(InstructionType::CMPM, {12, 20, 12, 20});
+
+    for (auto type : {InstructionType::OR, InstructionType::SUB, InstructionType::AND, InstructionType::ADD}) {
+        set(type, {4, 6, 8, 12});
+    }
+    set(InstructionType::EOR, {4, 8, 8, 12});
+    set(InstructionType::CMP, {4, 6, 4, 6});
+    set(InstructionType::CMPA, same(6));
+    set(InstructionType::ADDA, {8, 6, 8, 6});
+    set(InstructionType::SUBA, {8, 6, 8, 6});
+    set(InstructionType::EXG, same(6));
+
+    /// register forms: plus 2 per shift count
+    for (auto type : {InstructionType::ASL_REG, InstructionType::ASR_REG, InstructionType::LSL_REG, InstructionType::LSR_REG,
+                      InstructionType::ROXL_REG, InstructionType::ROXR_REG, InstructionType::ROL_REG, InstructionType::ROR_REG}) {
+        set(type, {6, 8, 6, 8});
+    }
+    for (auto type : {InstructionType::ASL_MEMORY, InstructionType::ASR_MEMORY, InstructionType::LSL_MEMORY, InstructionType::LSR_MEMORY,
+                      InstructionType::ROXL_MEMORY, InstructionType::ROXR_MEMORY, InstructionType::ROL_MEMORY, InstructionType::ROR_MEMORY}) {
+        set(type, same(8));
+    }
+    return table;
+}();
+
+constexpr size_t modeIndex(AddressingMode mode)
+{
+    return static_cast<size_t>(mode);
+}
+
+constexpr bool isRegisterMode(AddressingMode mode)
+{
+    return mode == AddressingMode::NONE || mode == AddressingMode::DATA_REGISTER || mode == AddressingMode::ADDRESS_REGISTER;
+}
+
+constexpr uint8_t eaCycles(AddressingMode mode, OperationSize size)
+{
+    return size == OperationSize::LONG ? EA_CYCLES_LONG[modeIndex(mode)] : EA_CYCLES[modeIndex(mode)];
+}
+
+constexpr bool isShiftRegisterType(InstructionType type)
+{
+    switch (type) {
+    case InstructionType::ASL_REG:
+    case InstructionType::ASR_REG:
+    case InstructionType::LSL_REG:
+    case InstructionType::LSR_REG:
+    case InstructionType::ROXL_REG:
+    case InstructionType::ROXR_REG:
+    case InstructionType::ROL_REG:
+    case InstructionType::ROR_REG:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Static time of a packed instruction: base time plus effective address calculation,
+ *        plus everything known at decode time (MOVEM register count, immediate shift count).
+ */
+constexpr uint16_t instructionCycles(const PackedInstruction& instruction)
+{
+    const auto type = instruction.type;
+    const auto mode = instruction.ea.mode;
+    const bool isLong = instruction.size == OperationSize::LONG;
+
+    switch (type) {
+    case InstructionType::MOVE: {
+        const auto destination = modeIndex(instruction.destinationEa.mode);
+        return static_cast<uint16_t>(4 + eaCycles(mode, instruction.size) +
+                                     (isLong ? MOVE_DESTINATION_CYCLES_LONG[destination] : MOVE_DESTINATION_CYCLES[destination]));
+    }
+    case InstructionType::MOVEA:
+        return static_cast<uint16_t>(4 + eaCycles(mode, instruction.size));
+    case InstructionType::LEA:
+        return LEA_CYCLES[modeIndex(mode)];
+    case InstructionType::PEA:
+        return PEA_CYCLES[modeIndex(mode)];
+    case InstructionType::JMP:
+        return JMP_CYCLES[modeIndex(mode)];
+    case InstructionType::JSR:
+        return JSR_CYCLES[modeIndex(mode)];
+    case InstructionType::MOVEM: {
+        /// param is MOVEM_InstructionData::Direction: REG_TO_MEM = 0, MEM_TO_REG = 1
+        const int base = instruction.param == 0 ? 8 : 12;
+        const int perRegister = isLong ? 8 : 4;
+        const int registers = std::popcount(static_cast<uint16_t>(instruction.immediate));
+        return static_cast<uint16_t>(base + perRegister * registers + MOVEM_EA_CYCLES[modeIndex(mode)]);
+    }
+    case InstructionType::MOVEP:
+        /// param is MOVEP_InstructionData::OpMode, long forms are odd
+        return (instruction.param & 1U) != 0 ? 24 : 16;
+    default:
+        break;
+    }
+
+    const auto& base = BASE_CYCLES[static_cast<size_t>(type)];
+    bool memory = !isRegisterMode(mode);
+    int extra = 0;
+
+    switch (type) {
+    case InstructionType::ADD:
+    case InstructionType::SUB:
+    case InstructionType::AND:
+    case InstructionType::OR:
+        memory = instruction.paramAs<DestinationOperandType>() == DestinationOperandType::DESTINATION_EA;
+        if (!memory && isLong && (isRegisterMode(mode) || mode == AddressingMode::IMMEDIATE)) {
+            extra = 2;
+        }
+        break;
+    case InstructionType::ADDA:
+    case InstructionType::SUBA:
+        if (isLong && (isRegisterMode(mode) || mode == AddressingMode::IMMEDIATE)) {
+            extra = 2;
+        }
+        break;
+    case InstructionType::ADDQ:
+    case InstructionType::SUBQ:
+        if (mode == AddressingMode::ADDRESS_REGISTER) {
+            return 8;
+        }
+        break;
+    case InstructionType::ABCD:
+    case InstructionType::SBCD:
+    case InstructionType::ADDX:
+    case InstructionType::SUBX:
+        memory = instruction.paramAs<OperandAddressingMode>() == OperandAddressingMode::MEM_TO_MEM;
+        break;
+    default:
+        if (isShiftRegisterType(type) && instruction.param == 0) {
+            /// immediate count, 0 encodes 8
+            extra = 2 * (instruction.reg2 == 0 ? 8 : instruction.reg2);
+        }
+        break;
+    }
+
+    const uint8_t baseCycles = memory ? (isLong ? base.memoryLong : base.memoryWord)
+                                      : (isLong ? base.registerLong : base.registerWord);
+    return static_cast<uint16_t>(baseCycles + eaCycles(mode, instruction.size) + extra);
+}
+
+/// Exception processing of bus and address errors
+constexpr int32_t GROUP0_EXCEPTION_CYCLES = 50;
+/// Exception processing of illegal, line A/F and privilege violation exceptions
+constexpr int32_t ILLEGAL_EXCEPTION_CYCLES = 34;
+/// Exception processing of an autovectored interrupt
+constexpr int32_t INTERRUPT_EXCEPTION_CYCLES = 44;
+
+/// Scc on a data register whose condition is true
+constexpr int32_t SCC_TRUE_EXTRA_CYCLES = 2;
+/// DBcc whose condition is true (12 cycles) or whose counter expired (14 cycles)
+constexpr int32_t DBCC_CONDITION_TRUE_EXTRA_CYCLES = 2;
+constexpr int32_t DBCC_COUNTER_EXPIRED_EXTRA_CYCLES = 4;
+
+/// Bcc not taken: 8 cycles for the byte displacement form, 12 for the word form
+constexpr int32_t bccNotTakenExtraCycles(const PackedInstruction& instruction)
+{
+    return instruction.lengthBytes == 2 ? -2 : 2;
+}
+
+/// Register counted shifts and rotates, count taken modulo 64
+constexpr int32_t shiftExtraCycles(uint32_t count)
+{
+    return static_cast<int32_t>(2 * (count % 64));
+}
+
+/// MULU: 2 cycles per set bit of the source
+constexpr int32_t muluExtraCycles(uint16_t source)
+{
+    return 2 * std::popcount(source);
+}
+
+/// MULS: 2 cycles per 01 or 10 bit pair of the source with a 0 appended below bit 0
+constexpr int32_t mulsExtraCycles(uint16_t source)
+{
+    return 2 * std::popcount(static_cast<uint16_t>(source ^ (source << 1U)));
+}
+
+/**
+ * @brief DIVU time, effective address excluded, for a non-zero divisor.
+ *
+ * Replays the microcode's shift-and-subtract loop: 10 cycles on overflow, 76 to 136 otherwise.
+ */
+constexpr int32_t divuCycles(uint32_t dividend, uint16_t divisor)
+{
+    if ((dividend >> 16U) >= divisor) {
+        return 10;
+    }
+
+    int32_t cycles = 38;
+    const uint32_t shiftedDivisor = static_cast<uint32_t>(divisor) << 16U;
+    for (int i = 0; i < 15; ++i) {
+        const bool carry = (dividend & 0x80000000U) != 0;
+        dividend <<= 1U;
+        if (carry) {
+            dividend -= shiftedDivisor;
+        } else {
+            cycles += 2;
+            if (dividend >= shiftedDivisor) {
+                dividend -= shiftedDivisor;
+                --cycles;
+            }
+        }
+    }
+    return cycles * 2;
+}
+
+/**
+ * @brief DIVS time, effective address excluded, for a non-zero divisor.
+ *
+ * 16 or 18 cycles on overflow, at most 156 otherwise.
+ */
+constexpr int32_t divsCycles(int32_t dividend, int16_t divisor)
+{
+    int32_t cycles = dividend < 0 ? 7 : 6;
+
+    const uint32_t absDividend = dividend < 0 ? 0U - static_cast<uint32_t>(dividend) : static_cast<uint32_t>(dividend);
+    const uint32_t absDivisor = divisor < 0 ? static_cast<uint32_t>(-static_cast<int32_t>(divisor)) : static_cast<uint32_t>(divisor);
+    if ((absDividend >> 16U) >= absDivisor) {
+        return (cycles + 2) * 2;
+    }
+
+    cycles += 55;
+    if (divisor >= 0) {
+        cycles += dividend >= 0 ? -1 : 1;
+    }
+
+    auto quotient = static_cast<uint16_t>(absDividend / absDivisor);
+    for (int i = 0; i < 15; ++i) {
+        if ((quotient & 0x8000U) == 0) {
+            ++cycles;
+        }
+        quotient = static_cast<uint16_t>(quotient << 1U);
+    }
+    return cycles * 2;
+}
+
+static_assert(muluExtraCycles(0xFFFF) == 32);
+static_assert(mulsExtraCycles(0x5555) == 32);
+static_assert(divuCycles(0x00010000, 1) == 10);
+static_assert(divuCycles(0, 1) >= 76 && divuCycles(0xFFFF, 0xFFFF) <= 136);
+
+} // namespace m68k::timing
+//NOLINTEND(*-magic-numbers)
@@ -0,0 +1,94 @@
+#pragma once
+#include <cpu/internal/instructions/instruction.h>
+#include <cpu/internal/instructions/instruction_params.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace m68k {
+
+/**
+ * @brief Effective address operand with its extension words already read.
+ *
+ * The meaning of extension() depends on mode:
+ *  - ADDRESS_WITH_DISPLACEMENT, PC_WITH_DISPLACEMENT: sign-extended displacement
+ *  - ADDRESS_WITH_INDEX, PC_WITH_INDEX: brief extension word in its 68000 layout
+ *    (bit 15 D/A, bits 14-12 register, bit 11 W/L, bits 7-0 displacement)
+ *  - ABSOLUTE_SHORT: sign-extended address, ABSOLUTE_LONG: address
+ *  - IMMEDIATE: immediate value
+ *
+ * The extension is split in two halves to keep the operand 2-byte aligned.
+ */
+struct PackedEffectiveAddress {
+    AddressingMode mode = AddressingMode::NONE;
+    uint8_t reg = 0;    ///< Dn or An of register based modes
+    uint16_t extensionHigh = 0;
+    uint16_t extensionLow = 0;
+
+    [[nodiscard]] constexpr uint32_t extension() const
+    {
+        return (static_cast<uint32_t>(extensionHigh) << 16U) | extensionLow; //NOLINT(*-magic-numbers)
+    }
+
+    constexpr void setExtension(uint32_t value)
+    {
+        extensionHigh = static_cast<uint16_t>(value >> 16U); //NOLINT(*-magic-numbers)
+        extensionLow = static_cast<uint16_t>(value);
+    }
+
+    [[nodiscard]] constexpr int8_t indexDisplacement() const { return static_cast<int8_t>(extensionLow & 0xFFU); } //NOLINT(*-magic-numbers)
+    [[nodiscard]] constexpr uint8_t indexRegister() const { return static_cast<uint8_t>((extensionLow >> 12U) & 0b111U); } //NOLINT(*-magic-numbers)
+    [[nodiscard]] constexpr bool indexIsAddressRegister() const { return (extensionLow & 0x8000U) != 0; } //NOLINT(*-magic-numbers)
+    /// D/A bit and register number together, the index register's Registers::R() field
+    [[nodiscard]] constexpr uint8_t indexRegisterField() const { return static_cast<uint8_t>(extensionLow >> 12U); } //NOLINT(*-magic-numbers)
+    [[nodiscard]] constexpr bool indexIsLong() const { return (extensionLow & 0x0800U) != 0; } //NOLINT(*-magic-numbers)
+};
+
+/**
+ * @brief Fixed-size, trivially copyable form of a decoded instruction.
+ *
+ * This is what the decode and block caches store and what executors receive. Built from
+ * the decoder's Instruction by packInstruction(); fields an instruction does not use are zero.
+ * The record also carries the instruction's static timing, so pacing costs no extra lookup.
+ */
+struct PackedInstruction {
+    /// Immediate data, branch/LINK/MOVEP displacement, MOVEM register mask, bit number or trap vector
+    int32_t immediate = 0;
+    InstructionType type = InstructionType::ILLEGAL;
+    OperationSize size = OperationSize::WORD;
+    uint8_t lengthBytes = 0;
+    /// Underlying value of the instruction's condition, direction, operand type, op mode or shift mode
+    uint8_t param = 0;
+    /// Register named by the opcode: Dn/An of two-operand forms, destination of ABCD/ADDX/CMPM..., Rx of EXG
+    uint8_t reg = 0;
+    /// Source of ABCD/ADDX/CMPM..., Ry of EXG, An of MOVEP, shift count or count register
+    uint8_t reg2 = 0;
+    /// Static execution time in clock cycles, see instruction_timing.h
+    uint16_t cycles = 0;
+    /// The instruction's effective address operand; MOVE source
+    PackedEffectiveAddress ea;
+    /// MOVE destination
+    PackedEffectiveAddress destinationEa;
+
+    [[nodiscard]] constexpr Condition condition() const { return static_cast<Condition>(param); }
+
+    template <typename Enum>
+    [[nodiscard]] constexpr Enum paramAs() const
+    {
+        return static_cast<Enum>(param);
+    }
+};
+
+static_assert(sizeof(PackedEffectiveAddress) == 6, "PackedEffectiveAddress must stay 6 bytes");
+static_assert(sizeof(PackedInstruction) <= 24, "PackedInstruction exceeds its 24 byte budget");
+static_assert(std::is_trivially_copyable_v<PackedInstruction>);
+
+/**
+ * @brief Pack a decoded instruction.
+ *
+ * Every field of the instruction's data struct is stored; a data struct with a field
+ * the packer does not know fails to compile rather than losing it.
+ * @param lengthBytes Length of the instruction including extension words
+ */
+[[nodiscard]] PackedInstruction packInstruction(const Instruction& instruction, uint32_t lengthBytes);
+
+} // namespace m68k
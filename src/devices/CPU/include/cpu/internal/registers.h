@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <cstdint>
+#include <utility>
 
 /**
  * @file registers.h
@@ -8,8 +9,8 @@
  *
  * This header declares the Registers struct which models the Motorola
  * 68000 CPU register state used by the emulator core. It includes
- * data registers, address registers, user and supervisor stack pointers,
- * program counter and a packed representation of the status register (SR).
+ * a flat data and address register file with banked user and supervisor stack
+ * pointers, program counter and the 16-bit status register (SR).
  */
 
 namespace m68k_ {
@@ -17,55 +18,123 @@ namespace m68k_ {
 /**
  * @brief Status Register (SR).
  *
- * Packed representation of the 16-bit SR. The low byte contains the
- * condition code flags (X, N, Z, V, C). The high byte contains
+ * The 16-bit SR in its 68000 layout. The low byte (CCR) contains the
+ * condition code flags (X, N, Z, V, C). The high byte contains the
  * interrupt mask, supervisor/user flag, master/interrupt state and trace bits.
  *
- * Note: Bitfield ordering here assumes typical little-endian target for storage,
- * but accessors should be used if strict portability or binary compatibility is required.
+ * Keeping the native layout makes stacking and restoring SR a single store and
+ * CCR/SR logic operations a single ALU operation on word().
  */
-struct StatusRegister{
+class StatusRegister {
+public:
+    //NOLINTBEGIN(*-magic-numbers)
+    static constexpr uint16_t CARRY_BIT = 0x0001;                   ///< Carry flag (C)
+    static constexpr uint16_t OVERFLOW_BIT = 0x0002;                ///< Overflow flag (V)
+    static constexpr uint16_t ZERO_BIT = 0x0004;                    ///< Zero flag (Z)
+    static constexpr uint16_t NEGATIVE_BIT = 0x0008;                ///< Negative flag (N)
+    static constexpr uint16_t EXTEND_BIT = 0x0010;                  ///< Extend flag (X) - used by multiple arithmetic ops
+    static constexpr uint16_t CONDITION_CODES = 0x001F;             ///< X, N, Z, V and C
+    static constexpr uint16_t INTERRUPT_MASK = 0x0700;              ///< Interrupt priority mask (I2..I0)
+    static constexpr uint16_t MASTER_OR_INTERRUPT_STATE = 0x1000;   ///< Master/Interrupt state (M)
+    static constexpr uint16_t SUPERVISOR_OR_USER_STATE = 0x2000;    ///< Supervisor/User state (S)
+    static constexpr uint16_t TRACE = 0xC000;                       ///< Trace mode bits (T1, T0)
+    /// Bits that exist; the others always read as zero
+    static constexpr uint16_t IMPLEMENTED = 0xF71F;
+    static constexpr unsigned INTERRUPT_MASK_SHIFT = 8;
+    static constexpr unsigned TRACE_SHIFT = 14;
+    //NOLINTEND(*-magic-numbers)
+
+    /// @name Whole register
+    /// @{
+    [[nodiscard]] constexpr uint16_t word() const { return word_; }
+    /// Load every bit but S, which Registers::setSupervisorState() changes
+    constexpr void setWord(uint16_t word)
+    {
+        word_ = static_cast<uint16_t>((word & IMPLEMENTED & ~SUPERVISOR_OR_USER_STATE) | (word_ & SUPERVISOR_OR_USER_STATE));
+    }
+    /// @}
+
     /// @name Condition code flags (lower byte)
     /// @{
-    bool carry : 1;     ///< Carry flag (C)
-    bool overflow : 1;  ///< Overflow flag (V)
-    bool zero : 1;      ///< Zero flag (Z)
-    bool negative : 1;  ///< Negative flag (N)
-    bool extend : 1;    ///< Extend flag (X) - used by multiple arithmetic ops
-    bool : 3;           ///< Padding to complete the lower byte
+    [[nodiscard]] constexpr bool carry() const { return (word_ & CARRY_BIT) != 0; }
+    [[nodiscard]] constexpr bool overflow() const { return (word_ & OVERFLOW_BIT) != 0; }
+    [[nodiscard]] constexpr bool zero() const { return (word_ & ZERO_BIT) != 0; }
+    [[nodiscard]] constexpr bool negative() const { return (word_ & NEGATIVE_BIT) != 0; }
+    [[nodiscard]] constexpr bool extend() const { return (word_ & EXTEND_BIT) != 0; }
+
+    constexpr void setCarry(bool value) { setBits(CARRY_BIT, value); }
+    constexpr void setOverflow(bool value) { setBits(OVERFLOW_BIT, value); }
+    constexpr void setZero(bool value) { setBits(ZERO_BIT, value); }
+    constexpr void setNegative(bool value) { setBits(NEGATIVE_BIT, value); }
+    constexpr void setExtend(bool value) { setBits(EXTEND_BIT, value); }
+
+    /// Replace the flags selected by mask with those of flags
+    constexpr void setConditionCodes(uint16_t flags, uint16_t mask = CONDITION_CODES)
+    {
+        word_ = static_cast<uint16_t>((word_ & ~mask) | (flags & mask));
+    }
     /// @}
+
     /// @name System flags (upper byte)
     /// @{
-    uint8_t interruptMask : 3;          ///< Interrupt priority mask (I2..I0)
-    bool : 1;                           ///< Reserved / padding
-    bool masterOrInterruptState : 1;    ///< Master/Interrupt state (M)
-    bool supervisorOrUserState : 1;     ///< Supervisor/User state (S)
-    uint8_t  trace : 2;                 ///< Trace mode bits (T1, T0)
+    [[nodiscard]] constexpr uint8_t interruptMask() const { return static_cast<uint8_t>((word_ & INTERRUPT_MASK) >> INTERRUPT_MASK_SHIFT); }
+    [[nodiscard]] constexpr bool masterOrInterruptState() const { return (word_ & MASTER_OR_INTERRUPT_STATE) != 0; }
+    [[nodiscard]] constexpr bool supervisorOrUserState() const { return (word_ & SUPERVISOR_OR_USER_STATE) != 0; }
+    [[nodiscard]] constexpr uint8_t trace() const { return static_cast<uint8_t>(word_ >> TRACE_SHIFT); }
+
+    constexpr void setInterruptMask(uint8_t level)
+    {
+        word_ = static_cast<uint16_t>((word_ & ~INTERRUPT_MASK) | ((level << INTERRUPT_MASK_SHIFT) & INTERRUPT_MASK));
+    }
+    constexpr void setTrace(uint8_t trace)
+    {
+        word_ = static_cast<uint16_t>((word_ & ~TRACE) | ((trace << TRACE_SHIFT) & TRACE));
+    }
     /// @}
+
+    bool operator==(const StatusRegister&) const = default;
+
+private:
+    friend struct Registers;
+
+    /// Only Registers changes S, it banks the stack pointers at the same time
+    constexpr void setSupervisorOrUserState(bool value) { setBits(SUPERVISOR_OR_USER_STATE, value); }
+
+    constexpr void setBits(uint16_t bits, bool value)
+    {
+        word_ = value ? static_cast<uint16_t>(word_ | bits) : static_cast<uint16_t>(word_ & ~bits);
+    }
+
+    uint16_t word_ = 0;
 };
+static_assert(sizeof(StatusRegister) == 2, "StatusRegister must stay a 16-bit word"); //NOLINT
+
 /**
  * @brief Complete CPU register state for the emulator.
  *
  * Contains:
- *  - Data registers D0..D7
- *  - Address registers A0..A6 (A7 is represented via usp/ssp)
- *  - User and Supervisor stack pointers (usp, ssp)
+ *  - A flat register file: D0..D7 followed by A0..A7, so the 4-bit register field of
+ *    extension words (D/A bit and register number) indexes it directly
+ *  - The inactive stack pointer: A7 always holds the active one, USP or SSP is
+ *    swapped in only when the S bit changes
  *  - Program counter (pc)
- *  - Status register (sr) broken out into condition codes and system flags
+ *  - Status register (sr)
+ *
+ * Register numbers are not checked; decoders only produce 3-bit and 4-bit fields.
  */
 struct Registers {
+    static constexpr int ADDRESS_REGISTERS_BASE = 8;
+    static constexpr int STACK_POINTER = 15;
 
     /**
      * @brief Access a data register (read/write).
      *
      * @param regNum Index of the data register [0..7].
      * @return Reference to the 32-bit data register.
-     *
-     * @throws std::out_of_range if regNum is outside [0..7].
      */
     uint32_t& D(int regNum) 
     {
-        return dataRegisters_.at(regNum);
+        return registers_[regNum];
     }
 
     /**
@@ -73,61 +142,63 @@ struct Registers {
      *
      * @param regNum Index of the data register [0..7].
      * @return Const reference to the 32-bit data register.
-     *
-     * @throws std::out_of_range if regNum is outside [0..7].
      */
     [[nodiscard]] const uint32_t& D(int regNum) const
     {
-        return dataRegisters_.at(regNum);
+        return registers_[regNum];
     }
 
     /**
      * @brief Access an address register (read/write).
      *
-     * If regNum == 7, returns the active stack pointer (A7) depending on
-     * the supervisor/user state stored in the SR.
+     * A7 is the active stack pointer, USP or SSP depending on the S bit.
      *
      * @param regNum Index of the address register [0..7] (7 is A7).
      * @return Reference to the 32-bit address register or active stack pointer.
-     *
-     * @throws std::out_of_range if regNum is outside [0..7) for normal A0..A6.
      */
     uint32_t& A(int regNum) 
     {
-        if (regNum == 7) { //NOLINT(*-magic-numbers)
-            return sr.supervisorOrUserState ? ssp : usp;
-        }
-
-        return addressRegisters_.at(regNum);
+        return registers_[ADDRESS_REGISTERS_BASE + regNum];
     }
 
     /**
      * @brief Access an address register (read-only).
      *
-     * If regNum == 7, returns the active stack pointer (A7) depending on
-     * the supervisor/user state stored in the SR.
+     * A7 is the active stack pointer, USP or SSP depending on the S bit.
      *
      * @param regNum Index of the address register [0..7] (7 is A7).
      * @return Const reference to the 32-bit address register or active stack pointer.
-     *
-     * @throws std::out_of_range if regNum is outside [0..7) for normal A0..A6.
      */
     [[nodiscard]] const uint32_t& A(int regNum) const 
     {
-        if (regNum == 7) { //NOLINT(*-magic-numbers)
-            return sr.supervisorOrUserState ? ssp : usp;
-        }
+        return registers_[ADDRESS_REGISTERS_BASE + regNum];
+    }
+
+    /**
+     * @brief Access a register by its 4-bit field: D0..D7 are 0..7, A0..A7 are 8..15.
+     * @return Reference to the 32-bit register.
+     */
+    uint32_t& R(int regField)
+    {
+        return registers_[regField];
+    }
 
-        return addressRegisters_.at(regNum);
+    /**
+     * @brief Access a register by its 4-bit field (read-only).
+     * @return Const reference to the 32-bit register.
+     */
+    [[nodiscard]] const uint32_t& R(int regField) const
+    {
+        return registers_[regField];
     }
 
     /**
      * @brief Get the Supervisor Stack Pointer (SSP).
-     * @return Reference to the 32-bit supervisor stack pointer.
+     * @return Reference to the 32-bit supervisor stack pointer, A7 in supervisor mode.
      */
     uint32_t& SSP() 
     { 
-        return ssp; 
+        return sr.supervisorOrUserState() ? registers_[STACK_POINTER] : inactiveStackPointer_;
     }
 
     /**
@@ -136,16 +207,16 @@ struct Registers {
      */
     [[nodiscard]] const uint32_t& SSP() const 
     { 
-        return ssp; 
+        return sr.supervisorOrUserState() ? registers_[STACK_POINTER] : inactiveStackPointer_;
     }
 
     /**
      * @brief Get the User Stack Pointer (USP).
-     * @return Reference to the 32-bit user stack pointer.
+     * @return Reference to the 32-bit user stack pointer, A7 in user mode.
      */
     uint32_t& USP() 
     { 
-        return usp; 
+        return sr.supervisorOrUserState() ? inactiveStackPointer_ : registers_[STACK_POINTER];
     }
 
     /**
@@ -154,7 +225,7 @@ struct Registers {
      */
     [[nodiscard]] const uint32_t& USP() const
     { 
-        return usp; 
+        return sr.supervisorOrUserState() ? inactiveStackPointer_ : registers_[STACK_POINTER];
     }
 
     /**
@@ -177,6 +248,9 @@ struct Registers {
 
     /**
      * @brief Access the status register (SR) for modification.
+     *
+     * The S bit is changed with setSupervisorState(), which banks the stack pointers.
+     *
      * @return Reference to the StatusRegister struct.
      */
     StatusRegister& SR()
@@ -193,32 +267,36 @@ struct Registers {
         return sr;
     }
 
+    /**
+     * @brief Set the S bit, swapping USP and SSP in A7 when it changes.
+     * @param supervisor true for supervisor mode, false for user mode.
+     */
+    void setSupervisorState(bool supervisor)
+    {
+        if (supervisor != sr.supervisorOrUserState()) {
+            std::swap(registers_[STACK_POINTER], inactiveStackPointer_);
+            sr.setSupervisorOrUserState(supervisor);
+        }
+    }
 
-private:
-    /// @brief Data registers
-    std::array<uint32_t, 8> dataRegisters_; //NOLINT(*-magic-numbers)
+    /// Same architectural state, used to detect loops that no longer change anything
+    bool operator==(const Registers&) const = default;
 
-    /// @brief Address registers
-    std::array<uint32_t, 7> addressRegisters_; //NOLINT(*-magic-numbers)
+private:
+    /// @brief D0..D7, A0..A7; A7 is the active stack pointer
+    std::array<uint32_t, 16> registers_; //NOLINT(*-magic-numbers)
 
     /**
-     * @brief User stack pointer (USP).
+     * @brief The stack pointer not in A7: SSP in user mode, USP in supervisor mode.
      *
      * The Motorola 68000 uses A7 as the active stack pointer. The emulator
-     * stores separate usp/ssp values and will swap them when changing
-     * between user and supervisor modes.
-     */
-    uint32_t usp;
-
-    /**
-     * @brief Supervisor stack pointer (SSP).
-     *
-     * Used when the CPU is in supervisor mode. See usp above.
+     * keeps the other one here and swaps them when changing between user
+     * and supervisor modes.
      */
-    uint32_t ssp;
+    uint32_t inactiveStackPointer_;
 
     /**
-     * @brief Program counter (PC).
+     * @brief Program counter (pc).
      *
      * Holds the byte address of the next instruction to fetch.
      */
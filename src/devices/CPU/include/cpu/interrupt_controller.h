@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace m68k {
+
+/**
+ * @brief Interrupt priority level input of the 68000 (IPL2-IPL0).
+ *
+ * Devices raise and lower their level from any thread. Several devices may hold
+ * different levels at the same time, the CPU sees the highest one. Levels 1-6 are
+ * level-sensitive, level 7 is non-maskable and taken once per rising edge.
+ *
+ * The CPU samples the input only between instruction batches, between the chained
+ * blocks of a batch and after SR writes, so an idle input costs one relaxed load and a
+ * compare per block.
+ */
+class InterruptController {
+public:
+    static constexpr uint8_t NMI_LEVEL = 7;
+
+    void raiseIPL(uint8_t level)
+    {
+        if (level == 0 || level > NMI_LEVEL) {
+            return;
+        }
+
+        const uint8_t previous = assertedLevels_.fetch_or(levelBit(level), std::memory_order_release);
+        if (level == NMI_LEVEL && (previous & levelBit(level)) == 0) {
+            nmiEdge_.store(true, std::memory_order_release);
+        }
+    }
+
+    void lowerIPL(uint8_t level)
+    {
+        if (level == 0 || level > NMI_LEVEL) {
+            return;
+        }
+
+        assertedLevels_.fetch_and(static_cast<uint8_t>(~levelBit(level)), std::memory_order_release);
+    }
+
+    /// Highest asserted level, 0 when no device requests an interrupt
+    [[nodiscard]] uint8_t pendingLevel() const
+    {
+        return static_cast<uint8_t>(std::bit_width(assertedLevels_.load(std::memory_order_relaxed)));
+    }
+
+    /**
+     * @brief Level the CPU has to service with the given SR interrupt mask, 0 for none.
+     *
+     * Consumes the level 7 edge when it is returned.
+     */
+    [[nodiscard]] uint8_t acknowledge(uint8_t interruptMask)
+    {
+        const uint8_t level = pendingLevel();
+        if (level == NMI_LEVEL) [[unlikely]] {
+            return nmiEdge_.exchange(false, std::memory_order_acquire) || interruptMask < NMI_LEVEL ? level : 0;
+        }
+        return level > interruptMask ? level : 0;
+    }
+
+    /// Whether acknowledge() would return a level, without consuming the level 7 edge
+    [[nodiscard]] bool pending(uint8_t interruptMask) const
+    {
+        const uint8_t level = pendingLevel();
+        if (level == NMI_LEVEL) [[unlikely]] {
+            return nmiEdge_.load(std::memory_order_relaxed) || interruptMask < NMI_LEVEL;
+        }
+        return level > interruptMask;
+    }
+
+private:
+    /// Level n is bit n-1, so the highest asserted level is the bit width
+    static constexpr uint8_t levelBit(uint8_t level)
+    {
+        return static_cast<uint8_t>(1U << (level - 1U));
+    }
+
+    std::atomic<uint8_t> assertedLevels_ = 0;
+    std::atomic<bool> nmiEdge_ = false;
+};
+
+} // namespace m68k
@@ -0,0 +1,88 @@
+#pragma once
+#include <cpu/cpu.h>
+#include <cpu/cpu_error.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <memoryinterface.h>
+#include <vector>
+
+namespace m68k {
+
+enum class LockstepError : uint8_t {
+    PRIMARY_FAILED,     ///< The block engine returned a CPUError
+    REFERENCE_FAILED,   ///< The reference interpreter returned a CPUError
+    STEPS_DIFFER,       ///< The interpreter could not execute as many steps as the block
+    REGISTERS_DIFFER,
+    MEMORY_DIFFERS      ///< A byte of a compared range differs, see LockstepDivergence::address
+};
+
+/// State of both CPUs after the first step that did not match
+struct LockstepDivergence {
+    uint32_t blockPc{};     ///< PC the diverging block started at
+    uint64_t steps{};       ///< CPU::steps() of the block engine after the block
+    m68k_::Registers primary;
+    m68k_::Registers reference;
+    uint32_t address{};     ///< First differing byte for LockstepError::MEMORY_DIFFERS
+};
+
+/**
+ * @brief Differential testing of the block engine against the instruction interpreter.
+ *
+ * Two CPUs run the same program on two buses mapped alike: the primary one block by
+ * block, with translated blocks, whichever dispatch loop the library was built with and
+ * the native segments of M68K_X86_64_JIT builds, the reference one instruction by
+ * instruction through the decoder and the executor table. After every block the
+ * reference catches up to the same CPU::steps() and both register files, and the memory
+ * ranges passed to compareMemory(), have to match.
+ *
+ * Idle loop fast-forwarding is part of run() and is not validated. Interrupts have to be
+ * raised through the validator so both CPUs see them at the same step.
+ */
+class LockstepValidator {
+public:
+    LockstepValidator(std::shared_ptr<DataExchange::MemoryInterface> primaryBus,
+                      std::shared_ptr<DataExchange::MemoryInterface> referenceBus);
+
+    /// Reset both CPUs; fails when either cannot read its reset vectors
+    std::expected<void, CPUError> reset();
+
+    /**
+     * @brief Run one block on the primary CPU, catch up with the reference one and compare.
+     *
+     * After an error the CPUs are left as they are, see divergence().
+     */
+    std::expected<void, LockstepError> step();
+
+    /// Compare length bytes from start on both buses after every step; reads must be side-effect free
+    void compareMemory(uint32_t start, uint32_t length);
+
+    void raiseIPL(uint8_t level);
+    void lowerIPL(uint8_t level);
+
+    /// Registers and memory can be set up through either CPU, as long as both get the same
+    CPU& primary();
+    CPU& reference();
+
+    /// State at the last step() that failed with a mismatch
+    [[nodiscard]] const LockstepDivergence& divergence() const;
+
+private:
+    struct MemoryRange {
+        uint32_t start;
+        uint32_t length;
+    };
+
+    std::expected<void, LockstepError> diverged(LockstepError error, uint32_t blockPc, uint32_t address = 0);
+
+private:
+    std::shared_ptr<DataExchange::MemoryInterface> primaryBus_;
+    std::shared_ptr<DataExchange::MemoryInterface> referenceBus_;
+    CPU primary_;
+    CPU reference_;
+    std::vector<MemoryRange> comparedRanges_;
+    LockstepDivergence divergence_;
+};
+
+} // namespace m68k
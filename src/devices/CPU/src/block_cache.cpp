@@ -0,0 +1,387 @@
+#include <instruction_decoder/block_cache.h>
+#include <instruction_decoder/native_translator.h>
+#include <instruction_executor/executor_table.h>
+#include <span>
+
+namespace m68k {
+
+namespace {
+
+/// Longest loop body considered for fast-forwarding
+constexpr size_t MAX_IDLE_LOOP_INSTRUCTIONS = 8;
+
+/// Bytes of immediate data between the opcode and the effective address extension words
+uint32_t immediateBytesBeforeEa(const PackedInstruction& instruction)
+{
+    switch (instruction.type) {
+    case InstructionType::BTST_IMMEDIATE:
+        return 2;
+    case InstructionType::CMPI:
+        return instruction.size == OperationSize::LONG ? 4 : 2; //NOLINT(*-magic-numbers)
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Operand read that returns the same value every iteration without changing anything.
+ * @param extensionPc Address of the operand's extension word, the base of PC-relative modes
+ */
+bool isSideEffectFreeRead(const PackedEffectiveAddress& ea, uint32_t extensionPc, const DataExchange::MemoryInterface& bus)
+{
+    switch (ea.mode) {
+    case AddressingMode::NONE:
+    case AddressingMode::DATA_REGISTER:
+    case AddressingMode::ADDRESS_REGISTER:
+    case AddressingMode::IMMEDIATE:
+        return true;
+    case AddressingMode::ABSOLUTE_SHORT:
+    case AddressingMode::ABSOLUTE_LONG:
+        return !bus.readHasSideEffects(ea.extension());
+    case AddressingMode::PC_WITH_DISPLACEMENT:
+        return !bus.readHasSideEffects(extensionPc + ea.extension());
+    default:
+        /// register based addresses are not known when the block is built
+        return false;
+    }
+}
+
+bool isRegisterDestination(const PackedEffectiveAddress& ea)
+{
+    return ea.mode == AddressingMode::DATA_REGISTER || ea.mode == AddressingMode::ADDRESS_REGISTER;
+}
+
+/// Instructions of a polling loop body: read, compare and test into registers only
+bool isPollingInstruction(const PackedInstruction& instruction, uint32_t instructionPc, const DataExchange::MemoryInterface& bus)
+{
+    /// immediate data, if any, comes before the operand's extension words
+    const uint32_t extensionPc = instructionPc + 2 + immediateBytesBeforeEa(instruction);
+    switch (instruction.type) {
+    case InstructionType::NOP:
+    case InstructionType::MOVEQ:
+        return true;
+    case InstructionType::TST:
+    case InstructionType::BTST_IMMEDIATE:
+    case InstructionType::BTST_REGISTER:
+    case InstructionType::CMP:
+    case InstructionType::CMPA:
+    case InstructionType::CMPI:
+        return isSideEffectFreeRead(instruction.ea, extensionPc, bus);
+    case InstructionType::MOVE:
+        return isRegisterDestination(instruction.destinationEa) && isSideEffectFreeRead(instruction.ea, extensionPc, bus);
+    case InstructionType::MOVEA:
+        return isSideEffectFreeRead(instruction.ea, extensionPc, bus);
+    case InstructionType::AND:
+    case InstructionType::OR:
+        return instruction.paramAs<DestinationOperandType>() == DestinationOperandType::DESTINATION_DN &&
+               isSideEffectFreeRead(instruction.ea, extensionPc, bus);
+    default:
+        return false;
+    }
+}
+
+IdleLoopKind classifyIdleLoop(const BasicBlock& block, const DataExchange::MemoryInterface& bus)
+{
+    if (block.instructions.empty() || block.instructions.size() > MAX_IDLE_LOOP_INSTRUCTIONS) {
+        return IdleLoopKind::NONE;
+    }
+
+    const auto& branch = block.instructions.back();
+    const uint32_t branchPc = block.endPc - branch.lengthBytes;
+    if (branchPc + 2 + static_cast<uint32_t>(branch.immediate) != block.startPc) {
+        return IdleLoopKind::NONE;
+    }
+
+    if (branch.type == InstructionType::DBcc) {
+        return block.instructions.size() == 1 ? IdleLoopKind::DBCC_DELAY : IdleLoopKind::NONE;
+    }
+    if (branch.type != InstructionType::BRA && branch.type != InstructionType::Bcc) {
+        return IdleLoopKind::NONE;
+    }
+
+    uint32_t instructionPc = block.startPc;
+    for (size_t i = 0; i + 1 < block.instructions.size(); ++i) {
+        if (!isPollingInstruction(block.instructions[i], instructionPc, bus)) {
+            return IdleLoopKind::NONE;
+        }
+        instructionPc += block.instructions[i].lengthBytes;
+    }
+
+    return IdleLoopKind::POLLING;
+}
+
+LoopIdiom classifyLoopIdiom(const BasicBlock& block)
+{
+    if (block.instructions.size() != 2) {
+        return LoopIdiom::NONE;
+    }
+
+    const auto& move = block.instructions.front();
+    const auto& dbcc = block.instructions.back();
+    if (move.type != InstructionType::MOVE || dbcc.type != InstructionType::DBcc || dbcc.condition() != Condition::FALSE) {
+        return LoopIdiom::NONE;
+    }
+
+    /// DBF's displacement is relative to its extension word
+    const uint32_t dbccPc = block.startPc + move.lengthBytes;
+    if (dbccPc + 2 + static_cast<uint32_t>(dbcc.immediate) != block.startPc) {
+        return LoopIdiom::NONE;
+    }
+
+    /// byte steps of A7 are 2, which a bulk operation does not do
+    const bool byteMove = move.size == OperationSize::BYTE;
+    const uint8_t destination = move.destinationEa.reg;
+    if (move.destinationEa.mode != AddressingMode::ADDRESS_WITH_POSTINCREMENT || (byteMove && destination == 7)) { //NOLINT(*-magic-numbers)
+        return LoopIdiom::NONE;
+    }
+
+    switch (move.ea.mode) {
+        case AddressingMode::ADDRESS_WITH_POSTINCREMENT:
+            return move.ea.reg != destination && !(byteMove && move.ea.reg == 7) ? LoopIdiom::COPY : LoopIdiom::NONE; //NOLINT(*-magic-numbers)
+        case AddressingMode::DATA_REGISTER:
+            return move.ea.reg != dbcc.reg ? LoopIdiom::FILL : LoopIdiom::NONE;
+        case AddressingMode::IMMEDIATE:
+            return LoopIdiom::FILL;
+        default:
+            return LoopIdiom::NONE;
+    }
+}
+
+void addSuccessor(BasicBlock& block, uint32_t pc) //NOLINT(*-identifier-length)
+{
+    block.successors.at(block.successorsCount++).pc = pc;
+}
+
+/// Addresses execution may continue at after the block, as far as its code tells
+void findSuccessors(BasicBlock& block)
+{
+    if (block.instructions.empty()) {
+        return;
+    }
+
+    const auto& last = block.instructions.back();
+    const uint32_t lastPc = block.endPc - last.lengthBytes;
+    /// displacements are relative to the extension word
+    const uint32_t branchTarget = lastPc + 2 + static_cast<uint32_t>(last.immediate);
+
+    switch (last.type) {
+        case InstructionType::BRA:
+        case InstructionType::BSR:
+            addSuccessor(block, branchTarget);
+            break;
+        case InstructionType::Bcc:
+        case InstructionType::DBcc:
+            addSuccessor(block, branchTarget);
+            addSuccessor(block, block.endPc);
+            break;
+        case InstructionType::JMP:
+            if (last.ea.mode == AddressingMode::ABSOLUTE_SHORT || last.ea.mode == AddressingMode::ABSOLUTE_LONG) {
+                addSuccessor(block, last.ea.extension());
+            }
+            break;
+        default:
+            if (!isBlockTerminator(last.type)) {
+                addSuccessor(block, block.endPc);
+            }
+            break;
+    }
+}
+
+void translate(BasicBlock& block)
+{
+    block.handlers.reserve(block.instructions.size());
+    for (const auto& instruction : block.instructions) {
+        block.handlers.push_back(executors_::resolveExecutor(instruction));
+    }
+#if defined(M68K_X86_64_JIT)
+    translateNative(block);
+#endif
+}
+
+} // namespace
+
+BlockCache::BlockCache(std::shared_ptr<DataExchange::MemoryInterface> bus, InstructionDecoder& decoder) :
+                                    bus_(std::move(bus))
+                                    , decoder_(decoder)
+{
+    bus_->addCodeWriteListener(this);
+}
+
+BlockCache::~BlockCache()
+{
+    bus_->removeCodeWriteListener(this);
+}
+
+std::expected<std::reference_wrapper<const BasicBlock>, DecodeError> BlockCache::fetch(uint32_t pc) //NOLINT(*-identifier-length)
+{
+    retiredBlocks_.clear();
+
+    if (previous_ != nullptr) {
+        for (const auto& link : std::span(previous_->successors).first(previous_->successorsCount)) {
+            if (link.pc == pc && link.block != nullptr) {
+                return enter(*link.block, pc);
+            }
+        }
+    }
+
+    if (auto blockIt = blocks_.find(pc); blockIt != blocks_.end()) {
+        return enter(*blockIt->second, pc);
+    }
+
+    bool cacheable = false;
+    auto buildResult = build(pc, cacheable);
+    if (!buildResult) {
+        return std::unexpected(buildResult.error());
+    }
+
+    auto block = std::make_unique<BasicBlock>(std::move(buildResult.value()));
+    auto& blockRef = *block;
+
+    if (!cacheable) {
+        previous_ = nullptr;
+        retire(std::move(uncachedBlock_));
+        uncachedBlock_ = std::move(block);
+        return std::cref(blockRef);
+    }
+
+    blocks_.emplace(pc, std::move(block));
+    return enter(blockRef, pc);
+}
+
+const BasicBlock* BlockCache::follow(const BasicBlock& block, uint32_t pc) //NOLINT(*-identifier-length)
+{
+    for (const auto& link : std::span(block.successors).first(block.successorsCount)) {
+        if (link.pc == pc) {
+            return link.block != nullptr ? &enter(*link.block, pc).get() : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+std::reference_wrapper<const BasicBlock> BlockCache::enter(BasicBlock& block, uint32_t pc) //NOLINT(*-identifier-length)
+{
+    if (++block.fetches == BasicBlock::HOT_FETCHES) [[unlikely]] {
+        translate(block);
+    }
+
+    if (previous_ != nullptr) {
+        for (auto& link : std::span(previous_->successors).first(previous_->successorsCount)) {
+            if (link.pc == pc && link.block == nullptr) {
+                link.block = &block;
+                block.predecessors.push_back(previous_);
+            }
+        }
+    }
+
+    previous_ = &block;
+    return std::cref(block);
+}
+
+std::expected<BasicBlock, DecodeError> BlockCache::build(uint32_t pc, bool& cacheable) //NOLINT(*-identifier-length)
+{
+    BasicBlock block{};
+    block.startPc = pc;
+    block.endPc = pc;
+    cacheable = true;
+
+    while (block.instructions.size() < BasicBlock::MAX_INSTRUCTIONS) {
+        auto decodeResult = decoder_.decodePacked(block.endPc);
+        if (!decodeResult) {
+            if (block.instructions.empty()) {
+                return std::unexpected(decodeResult.error());
+            }
+            /// the failing word is reported when execution reaches it
+            break;
+        }
+
+        const uint32_t lastAddr = block.endPc + decodeResult->lengthBytes - 1;
+        const auto firstPageType = bus_->codeMemoryType(block.endPc);
+        const auto lastPageType = bus_->codeMemoryType(lastAddr);
+        const bool instructionCacheable = firstPageType != DataExchange::CodeMemoryType::UNCACHEABLE &&
+                                          lastPageType != DataExchange::CodeMemoryType::UNCACHEABLE;
+
+        if (!instructionCacheable) {
+            if (!block.instructions.empty()) {
+                break;
+            }
+            /// uncacheable code runs one instruction per block
+            cacheable = false;
+        } else {
+            if (firstPageType == DataExchange::CodeMemoryType::WRITABLE) {
+                bus_->watchCodeWrites(block.endPc);
+            }
+            if (lastPageType == DataExchange::CodeMemoryType::WRITABLE) {
+                bus_->watchCodeWrites(lastAddr);
+            }
+        }
+
+        block.endPc += decodeResult->lengthBytes;
+        block.instructions.push_back(decodeResult.value());
+
+        if (!cacheable || isBlockTerminator(decodeResult->type)) {
+            break;
+        }
+    }
+
+    block.idleLoop = classifyIdleLoop(block, *bus_);
+    block.loopIdiom = classifyLoopIdiom(block);
+    findSuccessors(block);
+    return block;
+}
+
+void BlockCache::onCodeWrite(uint32_t pageStart, uint32_t pageSize)
+{
+    const uint64_t pageEnd = static_cast<uint64_t>(pageStart) + pageSize;
+
+    for (auto blockIt = blocks_.begin(); blockIt != blocks_.end();) {
+        const auto& block = *blockIt->second;
+        if (block.startPc < pageEnd && block.endPc > pageStart) {
+            retire(std::move(blockIt->second));
+            blockIt = blocks_.erase(blockIt);
+        } else {
+            ++blockIt;
+        }
+    }
+}
+
+void BlockCache::clear()
+{
+    for (auto& [startPc, block] : blocks_) {
+        retire(std::move(block));
+    }
+    blocks_.clear();
+}
+
+void BlockCache::retire(std::unique_ptr<BasicBlock> block)
+{
+    if (block) {
+        block->valid = false;
+        unlink(*block);
+        retiredBlocks_.push_back(std::move(block));
+    }
+}
+
+void BlockCache::unlink(BasicBlock& block)
+{
+    for (auto* predecessor : block.predecessors) {
+        for (auto& link : predecessor->successors) {
+            if (link.block == &block) {
+                link.block = nullptr;
+            }
+        }
+    }
+    block.predecessors.clear();
+
+    for (auto& link : block.successors) {
+        if (link.block != nullptr) {
+            std::erase(link.block->predecessors, &block);
+            link.block = nullptr;
+        }
+    }
+
+    if (previous_ == &block) {
+        previous_ = nullptr;
+    }
+}
+
+} // namespace m68k
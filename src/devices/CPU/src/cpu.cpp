@@ -2,64 +2,574 @@
 #include "cpu/internal/instruction_decoder/instruction_decoder.h"
 #include "cpu/internal/registers.h"
 #include <bus_helper/bus_helper.h>
+#include <cstdint>
+#include <instruction_executor/executor_table.h>
+#include <instructions/instruction_timing.h>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <span>
 
 namespace m68k {
 
+namespace {
+
+/// Opcodes 1010 and 1111 are unimplemented on the 68000 and trap through their own vectors
+constexpr uint16_t LINE_MASK = 0xF000;
+constexpr uint16_t LINE_A = 0xA000;
+constexpr uint16_t LINE_F = 0xF000;
+
+constexpr uint32_t vectorAddress(ExceptionVector vector)
+{
+    return static_cast<uint32_t>(vector) * 4;
+}
+
+/// Push onto the supervisor stack; false on a bus error or an odd stack pointer
+template <typename DataType>
+bool push(m68k_::Registers& regs, DataExchange::MemoryInterface& bus, DataType value)
+{
+    regs.SSP() -= sizeof(DataType);
+    if((regs.SSP() & 1U) != 0) {
+        return false;
+    }
+    return busHelper::write<DataType>(bus, regs.SSP(), value).has_value();
+}
+
+/// Cycles of a completed exception processing, or its host-level error
+std::expected<int64_t, CPUError> withCycles(const std::expected<void, CPUError>& result, int64_t cycles)
+{
+    if(!result) {
+        return std::unexpected(result.error());
+    }
+    return cycles;
+}
+
+uint32_t operandBytes(OperationSize size)
+{
+    return size == OperationSize::BYTE ? 1 : size == OperationSize::WORD ? 2 : 4; //NOLINT(*-magic-numbers)
+}
+
+/// Operand of a direct memory range just written, so the read cannot fail
+uint32_t readOperand(const DataExchange::MemoryInterface& bus, uint32_t address, OperationSize size)
+{
+    switch(size) {
+        case OperationSize::BYTE:
+            return busHelper::read<uint8_t>(bus, address).value_or(busHelper::MemoryAccessResult<uint8_t>{}).data;
+        case OperationSize::WORD:
+            return busHelper::read<uint16_t>(bus, address).value_or(busHelper::MemoryAccessResult<uint16_t>{}).data;
+        default:
+            return busHelper::read<uint32_t>(bus, address).value_or(busHelper::MemoryAccessResult<uint32_t>{}).data;
+    }
+}
+
+std::expected<void, CPUError> withoutCycles(const std::expected<int64_t, CPUError>& result)
+{
+    if(!result) {
+        return std::unexpected(result.error());
+    }
+    return {};
+}
+
+} // namespace
+
 CPU::CPU(std::shared_ptr<DataExchange::MemoryInterface> bus) :  bus_(std::move(bus)), 
                                                                 regs_{},
-                                                                instructionDecoder_(std::make_unique<InstructionDecoder>(bus_))
+                                                                instructionDecoder_(std::make_unique<InstructionDecoder>(bus_)),
+                                                                blockCache_(std::make_unique<BlockCache>(bus_, *instructionDecoder_))
 {
-    initExecutors();
+
 }
 
-void CPU::reset()
+std::expected<void, CPUError> CPU::reset()
 {
-    regs_.SR().supervisorOrUserState = true;
-    regs_.SR().interruptMask = 0b111; //NOLINT
+    halted_ = false;
+    stopped_ = false;
+    regs_.setSupervisorState(true);
+    regs_.SR().setTrace(0);
+    regs_.SR().setInterruptMask(0b111); //NOLINT
     
-    auto readResult = m68k::busHelper::read<uint32_t>(*bus_, 0);
-    if(!readResult){
-        throw std::runtime_error("Failed to read initial PC from bus during CPU reset.");
+    const auto sspResult = m68k::busHelper::read<uint32_t>(*bus_, vectorAddress(ExceptionVector::RESET_SSP));
+    const auto pcResult = m68k::busHelper::read<uint32_t>(*bus_, vectorAddress(ExceptionVector::RESET_PC));
+    if(!sspResult || !pcResult) {
+        halted_ = true;
+        return std::unexpected(CPUError::HALTED);
+    }
+
+    regs_.SSP() = sspResult->data;
+    regs_.PC() = pcResult->data;
+    return {};
+}
+
+std::expected<void, CPUError> CPU::executeNextInstruction()
+{
+    if(halted_) {
+        return std::unexpected(CPUError::HALTED);
     }
 
-    regs_.SSP() = readResult->data;
+    const auto interruptCycles = serviceInterrupt();
+    if(!interruptCycles || *interruptCycles != 0 || stopped_) {
+        return withoutCycles(interruptCycles);
+    }
 
-    readResult = m68k::busHelper::read<uint32_t>(*bus_, 4);
-    if(!readResult){
-        throw std::runtime_error("Failed to read initial PC from bus during CPU reset.");
+    const uint32_t instructionPc = regs_.PC();
+    if((instructionPc & 1U) != 0) {
+        ++steps_;
+        return processGroup0Exception(ExceptionVector::ADDRESS_ERROR, {.address = instructionPc, .read = true, .instructionFetch = true}, 0);
+    }
+
+    auto decodeResult = instructionDecoder_->decodeCached(instructionPc);
+    if(!decodeResult) {
+        return withoutCycles(fetchFault(instructionPc, decodeResult.error()));
     }
 
-    regs_.PC() = readResult->data;
+    regs_.PC() = instructionPc + decodeResult->lengthBytes;
+    return withoutCycles(execute(decodeResult.value(), instructionPc, &executors_::executeInstruction));
 }
 
-void CPU::initExecutors()
+std::expected<void, CPUError> CPU::executeBlock()
 {
-    executors_.reserve(static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT));
-    for(auto i = 0; i < static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT); ++i) {
-        executors_.emplace_back(std::nullopt);
+    if(halted_) {
+        return std::unexpected(CPUError::HALTED);
     }
+
+    const auto interruptCycles = serviceInterrupt();
+    if(!interruptCycles) {
+        return std::unexpected(interruptCycles.error());
+    }
+    if(stopped_) {
+        return {};
+    }
+
+    return withoutCycles(runBlock(std::numeric_limits<int64_t>::max(), false));
 }
 
+std::expected<int64_t, CPUError> CPU::run(int64_t cycles)
+{
+    if(halted_) {
+        return std::unexpected(CPUError::HALTED);
+    }
+
+    stopRequested_ = false;
+    int64_t usedCycles = 0;
+
+    while(usedCycles < cycles && !stopRequested_) {
+        const auto interruptCycles = serviceInterrupt();
+        if(!interruptCycles) {
+            return std::unexpected(interruptCycles.error());
+        }
+        usedCycles += *interruptCycles;
+
+        if(stopped_) [[unlikely]] {
+            /// nothing but an interrupt ends STOP, and none can arrive before the slice ends
+            if(usedCycles < cycles) {
+                fastForwardedCycles_ += cycles - usedCycles;
+                usedCycles = cycles;
+            }
+            break;
+        }
+
+        const auto blockCycles = runBlock(cycles - usedCycles, true);
+        if(!blockCycles) {
+            return std::unexpected(blockCycles.error());
+        }
+        usedCycles += *blockCycles;
+    }
+
+    return usedCycles;
+}
 
-void CPU::executeNextInstruction()
+void CPU::requestStop()
 {
-    auto decodeResult = instructionDecoder_->decode(regs_.PC());
-    if(!decodeResult) {
-        throw std::runtime_error("Failed to decode instruction at PC: " + std::to_string(regs_.PC()));
+    stopRequested_ = true;
+}
+
+std::expected<int64_t, CPUError> CPU::runBlock(int64_t budget, bool fastForward)
+{
+    endBatch_ = false;
+    const uint32_t startPc = regs_.PC();
+    if((startPc & 1U) != 0) [[unlikely]] {
+        ++steps_;
+        return withCycles(processGroup0Exception(ExceptionVector::ADDRESS_ERROR, {.address = startPc, .read = true, .instructionFetch = true}, 0),
+                          timing::GROUP0_EXCEPTION_CYCLES);
     }
 
-    const auto& instruction = decodeResult->instruction;
-    auto& executorOpt = executors_.at(static_cast<size_t>(instruction.type()));
-    if(!executorOpt.has_value()) {
-        throw std::runtime_error("No executor for instruction at PC: " + std::to_string(regs_.PC()));
+    auto blockResult = blockCache_->fetch(startPc);
+    if(!blockResult) [[unlikely]] {
+        return fetchFault(startPc, blockResult.error());
+    }
+
+    const BasicBlock* block = &blockResult->get();
+    int64_t usedCycles = 0;
+    while(true) {
+        const auto blockCycles = runFetchedBlock(*block, budget - usedCycles, fastForward);
+        if(!blockCycles) [[unlikely]] {
+            return blockCycles;
+        }
+        usedCycles += *blockCycles;
+
+        /// anything that ends a batch between blocks sends execution back to run()
+        if(!fastForward || usedCycles >= budget || stopRequested_ || endBatch_ || !block->valid ||
+           interruptController_.pending(regs_.SR().interruptMask())) {
+            break;
+        }
+
+        block = blockCache_->follow(*block, regs_.PC());
+        if(block == nullptr) {
+            break;
+        }
     }
 
-    auto executeResult = executorOpt.value()->execute(instruction);
+    return usedCycles;
+}
+
+std::expected<int64_t, CPUError> CPU::runFetchedBlock(const BasicBlock& block, int64_t budget, bool fastForward)
+{
+    if(fastForward && block.loopIdiom != LoopIdiom::NONE) [[unlikely]] {
+        if(const auto idiomCycles = runLoopIdiom(block, budget)) {
+            return *idiomCycles;
+        }
+    }
+
+    const bool idleCandidate = fastForward && block.idleLoop != IdleLoopKind::NONE;
+    std::optional<m68k_::Registers> before;
+    if(idleCandidate) [[unlikely]] {
+        flags_.materialize(regs_.SR());
+        before = regs_;
+    }
+
+    const auto instructionsCycles = runInstructions(block, budget);
+    if(!instructionsCycles) [[unlikely]] {
+        return instructionsCycles;
+    }
+    int64_t usedCycles = *instructionsCycles;
+
+    /// the loop branched back to its start: it ran exactly once
+    if(idleCandidate && !stopRequested_ && !endBatch_ && regs_.PC() == block.startPc && block.valid) [[unlikely]] {
+        usedCycles += skipIdleLoop(block, *before, usedCycles, budget - usedCycles);
+    }
+
+    return usedCycles;
+}
+
+#if !defined(M68K_THREADED_DISPATCH)
+std::expected<int64_t, CPUError> CPU::runInstructions(const BasicBlock& block, int64_t budget)
+{
+    uint32_t nextPc = block.startPc;
+    int64_t usedCycles = 0;
+    const bool translated = !block.handlers.empty();
+
+    for(size_t index = 0; index < block.instructions.size(); ++index) {
+        const auto& instruction = block.instructions[index];
+        /// a taken branch, an exception or a write to the block's code left the straight-line path
+        if(regs_.PC() != nextPc || !block.valid) {
+            break;
+        }
+
+#if defined(M68K_X86_64_JIT)
+        if(!block.nativeSegments.empty()) {
+            const auto& segment = block.nativeSegments[index];
+            if(segment.entry != nullptr && usedCycles + segment.cyclesBeforeLast < budget) {
+                runNativeSegment(segment);
+                nextPc += segment.lengthBytes;
+                regs_.PC() = nextPc;
+                usedCycles += segment.cycles;
+                index += segment.instructionsCount - 1U;
+                if(usedCycles >= budget) {
+                    break;
+                }
+                continue;
+            }
+        }
+#endif
+
+        const uint32_t instructionPc = nextPc;
+        nextPc += instruction.lengthBytes;
+        regs_.PC() = nextPc;
+
+        const auto executor = translated ? block.handlers[index] : &executors_::executeInstruction;
+        const auto instructionCycles = execute(instruction, instructionPc, executor);
+        if(!instructionCycles) [[unlikely]] {
+            return std::unexpected(instructionCycles.error());
+        }
+        usedCycles += *instructionCycles;
+        if(usedCycles >= budget || stopRequested_ || endBatch_) {
+            break;
+        }
+    }
+
+    return usedCycles;
+}
+#endif
+
+#if defined(M68K_X86_64_JIT)
+void CPU::runNativeSegment(const NativeSegment& segment)
+{
+    if(segment.setsFlags) {
+        /// X stays as the pending operation left it, N/Z/V/C are replaced
+        flags_.materialize(regs_.SR());
+        const auto conditionCodes = static_cast<uint16_t>(segment.entry(&regs_.D(0)));
+        regs_.SR().setConditionCodes(conditionCodes, m68k_::StatusRegister::CONDITION_CODES & ~m68k_::StatusRegister::EXTEND_BIT);
+    } else {
+        static_cast<void>(segment.entry(&regs_.D(0)));
+    }
+    steps_ += segment.instructionsCount;
+}
+#endif
+
+int64_t CPU::skipIdleLoop(const BasicBlock& block, const m68k_::Registers& before, int64_t iterationCycles, int64_t budget)
+{
+    /// an interrupt that became pending meanwhile is taken at the next batch
+    if(iterationCycles <= 0 || interruptController_.pendingLevel() > regs_.SR().interruptMask()) {
+        return 0;
+    }
+
+    int64_t iterations = budget / iterationCycles;
+    if(block.idleLoop == IdleLoopKind::POLLING) {
+        /// the same reads into the same registers give the same result every time
+        flags_.materialize(regs_.SR());
+        if(regs_ != before) {
+            return 0;
+        }
+    } else {
+        /// DBcc loops until its counter wraps to -1; each skipped iteration only decrements it
+        auto& counter = regs_.D(block.instructions.front().reg);
+        const uint32_t counterWord = counter & 0xFFFFU; //NOLINT(*-magic-numbers)
+        iterations = std::min<int64_t>(iterations, counterWord);
+        counter = (counter & 0xFFFF0000U) | (counterWord - static_cast<uint32_t>(iterations)); //NOLINT(*-magic-numbers)
+    }
+
+    const int64_t skippedCycles = iterations * iterationCycles;
+    fastForwardedCycles_ += skippedCycles;
+    return skippedCycles;
+}
+
+std::optional<int64_t> CPU::runLoopIdiom(const BasicBlock& block, int64_t budget)
+{
+    const auto& move = block.instructions.front();
+    const auto& dbcc = block.instructions.back();
+    const int64_t iterationCycles = move.cycles + dbcc.cycles;
+
+    /// whole iterations within budget, fewer than two are not worth it
+    auto& counter = regs_.D(dbcc.reg);
+    const uint32_t remaining = (counter & 0xFFFFU) + 1; //NOLINT(*-magic-numbers)
+    const auto iterations = static_cast<uint32_t>(std::min<int64_t>(remaining, budget / iterationCycles));
+    if(iterations < 2) {
+        return std::nullopt;
+    }
+
+    const uint32_t elementSize = operandBytes(move.size);
+    const uint32_t length = iterations * elementSize;
+    auto& destination = regs_.A(move.destinationEa.reg);
+    const uint64_t destinationEnd = static_cast<uint64_t>(destination) + length;
+    /// odd addresses fault and a loop overwriting its own code runs what it wrote: both are left to the interpreter
+    if((elementSize > 1 && (destination & 1U) != 0) || (destination < block.endPc && destinationEnd > block.startPc)) {
+        return std::nullopt;
+    }
+
+    uint32_t lastValue = 0;
+    if(block.loopIdiom == LoopIdiom::COPY) {
+        auto& source = regs_.A(move.ea.reg);
+        if((elementSize > 1 && (source & 1U) != 0) || !bus_->copyMemory(destination, source, length)) {
+            return std::nullopt;
+        }
+        lastValue = readOperand(*bus_, static_cast<uint32_t>(destinationEnd - elementSize), move.size);
+        source += length;
+    } else {
+        lastValue = move.ea.mode == AddressingMode::IMMEDIATE ? move.ea.extension() : regs_.D(move.ea.reg);
+        std::array<uint8_t, sizeof(uint32_t)> pattern{};
+        for(uint32_t i = 0; i < elementSize; ++i) {
+            pattern.at(i) = static_cast<uint8_t>(lastValue >> ((elementSize - 1 - i) * 8)); //NOLINT(*-magic-numbers)
+        }
+        if(!bus_->fillMemory(destination, length, std::span(pattern).first(elementSize))) {
+            return std::nullopt;
+        }
+    }
+
+    destination += length;
+    counter = (counter & 0xFFFF0000U) | ((counter - iterations) & 0xFFFFU); //NOLINT(*-magic-numbers)
+    flags_.setLogic(move.size, lastValue);
+    steps_ += 2ULL * iterations;
+
+    int64_t cycles = iterations * iterationCycles;
+    if(iterations == remaining) {
+        regs_.PC() = block.endPc;
+        cycles += timing::DBCC_COUNTER_EXPIRED_EXTRA_CYCLES;
+    }
+    return cycles;
+}
+
+std::expected<int64_t, CPUError> CPU::execute(const PackedInstruction& instruction, uint32_t instructionPc, executors_::ExecutorFunction executor)
+{
+    executors_::ExecutionContext context{.regs = regs_, .bus = *bus_, .flags = flags_, .instructionPc = instructionPc};
+    return completeInstruction(instruction, context, executor(context, instruction));
+}
+
+std::expected<int64_t, CPUError> CPU::completeInstruction(const PackedInstruction& instruction, const executors_::ExecutionContext& context,
+                                                          const std::expected<void, ExecuteError>& executeResult)
+{
+    ++steps_;
+    if(!executeResult) [[unlikely]] {
+        return executeFault(instruction, context.instructionPc, context, executeResult.error());
+    }
+
+    if(context.statusRegisterWritten) [[unlikely]] {
+        endBatch_ = true;
+        stopped_ = context.stopped;
+    }
+    return instruction.cycles + context.extraCycles;
+}
+
+std::expected<int64_t, CPUError> CPU::serviceInterrupt()
+{
+    const uint8_t level = interruptController_.acknowledge(regs_.SR().interruptMask());
+    if(level == 0) [[likely]] {
+        return 0;
+    }
+
+    stopped_ = false;
+    ++steps_;
+
+    /// the Genesis acknowledges every interrupt with an autovector
+    const auto vector = static_cast<ExceptionVector>(static_cast<uint8_t>(ExceptionVector::SPURIOUS_INTERRUPT) + level);
+    const auto result = processException(vector, regs_.PC());
+    regs_.SR().setInterruptMask(level);
+    return withCycles(result, timing::INTERRUPT_EXCEPTION_CYCLES);
+}
+
+std::expected<int64_t, CPUError> CPU::fetchFault(uint32_t pc, DecodeError error) //NOLINT(*-identifier-length)
+{
+    ++steps_;
+    if(error == DecodeError::MEMORY_READ_FAILURE) {
+        return withCycles(processGroup0Exception(ExceptionVector::BUS_ERROR, {.address = pc, .read = true, .instructionFetch = true}, 0),
+                          timing::GROUP0_EXCEPTION_CYCLES);
+    }
+
+    /// the opcode word was readable, otherwise decoding would have failed with a read failure
+    const auto opcodeWord = busHelper::read<uint16_t>(*bus_, pc);
+    const uint16_t opcode = opcodeWord ? opcodeWord->data : 0;
+
+    ExceptionVector vector = ExceptionVector::ILLEGAL_INSTRUCTION;
+    if((opcode & LINE_MASK) == LINE_A) {
+        vector = ExceptionVector::LINE_A;
+    } else if((opcode & LINE_MASK) == LINE_F) {
+        vector = ExceptionVector::LINE_F;
+    }
+
+    return withCycles(processException(vector, pc), timing::ILLEGAL_EXCEPTION_CYCLES);
+}
+
+std::expected<int64_t, CPUError> CPU::executeFault(const PackedInstruction& instruction, uint32_t instructionPc,
+                                                   const executors_::ExecutionContext& context, ExecuteError error)
+{
+    const int64_t instructionCycles = instruction.cycles + context.extraCycles;
+
+    switch(error) {
+    case ExecuteError::UNIMPLEMENTED_INSTRUCTION:
+        return std::unexpected(CPUError::UNIMPLEMENTED_INSTRUCTION);
+    case ExecuteError::INVALID_INSTRUCTION:
+    case ExecuteError::INVALID_OPERATION_SIZE:
+        return withCycles(processException(ExceptionVector::ILLEGAL_INSTRUCTION, instructionPc), timing::ILLEGAL_EXCEPTION_CYCLES);
+    case ExecuteError::MEMORY_READ_FAILURE:
+    case ExecuteError::MEMORY_WRITE_FAILURE:
+    case ExecuteError::ADDRESS_ERROR: {
+        const auto vector = error == ExecuteError::ADDRESS_ERROR ? ExceptionVector::ADDRESS_ERROR : ExceptionVector::BUS_ERROR;
+        const FaultAccess access{.address = context.faultAddress, .read = error != ExecuteError::MEMORY_WRITE_FAILURE && !context.faultOnWrite,
+                                   .instructionFetch = false};
+        const auto opcodeWord = busHelper::read<uint16_t>(*bus_, instructionPc);
+        return withCycles(processGroup0Exception(vector, access, opcodeWord ? opcodeWord->data : 0),
+                          instructionCycles + timing::GROUP0_EXCEPTION_CYCLES);
+    }
+    case ExecuteError::EXCEPTION:
+        break;
+    }
+
+    /// illegal and privileged instructions are retried after the handler returns, traps continue after the instruction
+    const auto vector = context.exceptionVector;
+    const bool retry = vector == ExceptionVector::ILLEGAL_INSTRUCTION || vector == ExceptionVector::PRIVILEGE_VIOLATION ||
+                       vector == ExceptionVector::LINE_A || vector == ExceptionVector::LINE_F;
+    return withCycles(processException(vector, retry ? instructionPc : regs_.PC()), instructionCycles);
+}
+
+std::expected<void, CPUError> CPU::processException(ExceptionVector vector, uint32_t returnPc)
+{
+    const uint16_t statusRegister = flags_.materialize(regs_.SR()).word();
+    regs_.setSupervisorState(true);
+    regs_.SR().setTrace(0);
+
+    if(!push<uint32_t>(regs_, *bus_, returnPc) || !push<uint16_t>(regs_, *bus_, statusRegister)) {
+        const auto stackVector = (regs_.SSP() & 1U) != 0 ? ExceptionVector::ADDRESS_ERROR : ExceptionVector::BUS_ERROR;
+        return processGroup0Exception(stackVector, {.address = regs_.SSP(), .read = false, .instructionFetch = false}, 0);
+    }
+
+    const auto handler = busHelper::read<uint32_t>(*bus_, vectorAddress(vector));
+    if(!handler) {
+        return processGroup0Exception(ExceptionVector::BUS_ERROR, {.address = vectorAddress(vector), .read = true, .instructionFetch = false}, 0);
+    }
+
+    regs_.PC() = handler->data;
+    return {};
+}
+
+std::expected<void, CPUError> CPU::processGroup0Exception(ExceptionVector vector, const FaultAccess& access, uint16_t instructionWord)
+{
+    const bool supervisor = regs_.SR().supervisorOrUserState();
+    const uint16_t statusRegister = flags_.materialize(regs_.SR()).word();
+    regs_.setSupervisorState(true);
+    regs_.SR().setTrace(0);
+
+    //NOLINTBEGIN(*-magic-numbers)
+    /// special status word: R/W, I/N and the function code of the faulted access
+    uint16_t accessStatus = access.instructionFetch ? (supervisor ? 6U : 2U) : (supervisor ? 5U : 1U);
+    if(access.read) {
+        accessStatus |= 0x10U;
+    }
+    if(!access.instructionFetch) {
+        accessStatus |= 0x08U;
+    }
+    //NOLINTEND(*-magic-numbers)
+
+    const bool stacked = push<uint32_t>(regs_, *bus_, regs_.PC()) &&
+                         push<uint16_t>(regs_, *bus_, statusRegister) &&
+                         push<uint16_t>(regs_, *bus_, instructionWord) &&
+                         push<uint32_t>(regs_, *bus_, access.address) &&
+                         push<uint16_t>(regs_, *bus_, accessStatus);
+    if(!stacked) {
+        /// double bus fault
+        halted_ = true;
+        return std::unexpected(CPUError::HALTED);
+    }
+
+    const auto handler = busHelper::read<uint32_t>(*bus_, vectorAddress(vector));
+    if(!handler) {
+        halted_ = true;
+        return std::unexpected(CPUError::HALTED);
+    }
+
+    regs_.PC() = handler->data;
+    return {};
 }
 
 m68k_::Registers& CPU::registers()
 {
+    /// callers may read or overwrite the condition codes
+    flags_.materialize(regs_.SR());
     return regs_;
 }
 
+int64_t CPU::fastForwardedCycles() const
+{
+    return fastForwardedCycles_;
+}
+
+uint64_t CPU::steps() const
+{
+    return steps_;
+}
+
+InterruptController& CPU::interruptController()
+{
+    return interruptController_;
+}
+
 } // namespace m68k
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include <instruction_decoder/decode_cache.h>
+
+namespace m68k {
+
+DecodeCache::DecodeCache() : entries_(ENTRIES_COUNT)
+{
+
+}
+
+void DecodeCache::insert(uint32_t pc, const PackedInstruction& instruction) //NOLINT(*-identifier-length)
+{
+    auto& entry = entries_[indexOf(pc)];
+    entry.pc = pc;
+    entry.instruction = instruction;
+}
+
+void DecodeCache::onCodeWrite(uint32_t pageStart, uint32_t pageSize)
+{
+    const uint64_t pageEnd = static_cast<uint64_t>(pageStart) + pageSize;
+
+    for (auto& entry : entries_) {
+        if (entry.pc == INVALID_PC) {
+            continue;
+        }
+
+        /// instructions may start in the previous page and reach into the written one
+        const uint64_t instructionEnd = static_cast<uint64_t>(entry.pc) + entry.instruction.lengthBytes;
+        if (entry.pc < pageEnd && instructionEnd > pageStart) {
+            entry.pc = INVALID_PC;
+        }
+    }
+}
+
+void DecodeCache::clear()
+{
+    for (auto& entry : entries_) {
+        entry.pc = INVALID_PC;
+    }
+}
+
+} // namespace m68k
@@ -31,9 +31,9 @@ std::expected<DecodeResult, DecodeError> MOVE_Decoder::decode(uint16_t opcodeWor
     const auto sizeValue = (opcodeWord & SIZE_MASK) >> 12U; //NOLINT
 
     switch(sizeValue) {
-        case 0b01: instructionData.size = OperationSize::BYTE;
-        case 0b11: instructionData.size = OperationSize::WORD;
-        case 0b10: instructionData.size = OperationSize::LONG;
+        case 0b01: instructionData.size = OperationSize::BYTE; break;
+        case 0b11: instructionData.size = OperationSize::WORD; break;
+        case 0b10: instructionData.size = OperationSize::LONG; break;
         default: return std::unexpected(DecodeError::INVALID_INSTRUCTION_SIZE);
     }
 
@@ -64,8 +64,8 @@ std::expected<DecodeResult, DecodeError> MOVE_Decoder::decode(uint16_t opcodeWor
 
     instructionData.sourceAddressingModeData = *convertedSrcAddressingModeData;
 
-    const uint8_t dstRegisterValue = (opcodeWord & DST_REGISTER_MASK);
-    const uint8_t dstModeValue = (opcodeWord & DST_MODE_MASK) >> 3U; //NOLINT
+    const uint8_t dstRegisterValue = (opcodeWord & DST_REGISTER_MASK) >> 9U; //NOLINT
+    const uint8_t dstModeValue = (opcodeWord & DST_MODE_MASK) >> 6U; //NOLINT
 
     const auto dstAddressingMode = getAddressingMode(dstModeValue, dstRegisterValue);
     if(!dstAddressingMode) {
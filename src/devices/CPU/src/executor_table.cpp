@@ -0,0 +1,64 @@
+#include <array>
+#include <cstddef>
+#include <instruction_executor/executor.h>
+#include <instruction_executor/executor_table.h>
+#include <instruction_executor/operand_dispatch.h>
+#include <instruction_executor/executors/BRA_executor.h>
+#include <instruction_executor/executors/Bcc_executor.h>
+#include <instruction_executor/executors/DBcc_executor.h>
+#include <instruction_executor/executors/ILLEGAL_executor.h>
+#include <instruction_executor/executors/MOVE_executor.h>
+#include <instruction_executor/executors/MOVEQ_executor.h>
+#include <instruction_executor/executors/NOP_executor.h>
+#include <instruction_executor/executors/STOP_executor.h>
+#include <instruction_executor/executors/TRAP_executor.h>
+#include <utility>
+
+namespace m68k::executors_ {
+
+/// Fallback for instructions whose executor is not implemented yet
+template <InstructionType Type>
+std::expected<void, ExecuteError> execute(ExecutionContext& /*context*/, const PackedInstruction& /*instruction*/)
+{
+    return std::unexpected(ExecuteError::UNIMPLEMENTED_INSTRUCTION);
+}
+
+template <InstructionType Type>
+ExecutorFunction resolve(const PackedInstruction& /*instruction*/)
+{
+    return &execute<Type>;
+}
+
+namespace {
+
+template <size_t... Indexes>
+constexpr std::array<ExecutorFunction, sizeof...(Indexes)> makeExecutorTable(std::index_sequence<Indexes...> /*indexes*/)
+{
+    return {&execute<static_cast<InstructionType>(Indexes)>...};
+}
+
+constexpr auto executorTable = makeExecutorTable(std::make_index_sequence<static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT)>{});
+
+using ResolverFunction = ExecutorFunction (*)(const PackedInstruction&);
+
+template <size_t... Indexes>
+constexpr std::array<ResolverFunction, sizeof...(Indexes)> makeResolverTable(std::index_sequence<Indexes...> /*indexes*/)
+{
+    return {&resolve<static_cast<InstructionType>(Indexes)>...};
+}
+
+constexpr auto resolverTable = makeResolverTable(std::make_index_sequence<static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT)>{});
+
+} // namespace
+
+std::expected<void, ExecuteError> executeInstruction(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    return executorTable[static_cast<size_t>(instruction.type)](context, instruction); //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+ExecutorFunction resolveExecutor(const PackedInstruction& instruction)
+{
+    return resolverTable[static_cast<size_t>(instruction.type)](instruction); //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,13 @@
+#include <instruction_executor/executors/BRA_executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::BRA>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    /// displacement is relative to the extension word, i.e. the instruction address + 2
+    context.regs.PC() = context.instructionPc + 2 + static_cast<uint32_t>(instruction.immediate);
+    return {};
+}
+
+} //namespace m68k::executors_
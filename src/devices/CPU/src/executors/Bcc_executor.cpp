@@ -0,0 +1,19 @@
+#include <instruction_executor/condition.h>
+#include <instruction_executor/executors/Bcc_executor.h>
+#include <instructions/instruction_timing.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::Bcc>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    if (!testCondition(instruction.condition(), context.flags.materialize(context.regs.SR()))) {
+        context.extraCycles = timing::bccNotTakenExtraCycles(instruction);
+        return {};
+    }
+
+    context.regs.PC() = context.instructionPc + 2 + static_cast<uint32_t>(instruction.immediate);
+    return {};
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,29 @@
+#include <instruction_executor/condition.h>
+#include <instruction_executor/executors/DBcc_executor.h>
+#include <instructions/instruction_timing.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::DBcc>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    if (testCondition(instruction.condition(), context.flags.materialize(context.regs.SR()))) {
+        context.extraCycles = timing::DBCC_CONDITION_TRUE_EXTRA_CYCLES;
+        return {};
+    }
+
+    /// only the low word of the counter is decremented
+    auto& reg = context.regs.D(instruction.reg);
+    const auto counter = static_cast<uint16_t>(static_cast<uint16_t>(reg) - 1U);
+    reg = (reg & 0xFFFF0000U) | counter; //NOLINT(*-magic-numbers)
+
+    if (counter != 0xFFFFU) { //NOLINT(*-magic-numbers)
+        context.regs.PC() = context.instructionPc + 2 + static_cast<uint32_t>(instruction.immediate);
+    } else {
+        context.extraCycles = timing::DBCC_COUNTER_EXPIRED_EXTRA_CYCLES;
+    }
+
+    return {};
+}
+
+} //namespace m68k::executors_
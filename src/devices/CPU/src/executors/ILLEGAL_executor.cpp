@@ -0,0 +1,11 @@
+#include <instruction_executor/executors/ILLEGAL_executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::ILLEGAL>(ExecutionContext& context, const PackedInstruction& /*instruction*/)
+{
+    return raiseException(context, ExceptionVector::ILLEGAL_INSTRUCTION);
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,16 @@
+#include <instruction_executor/executors/MOVEQ_executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::MOVEQ>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    /// the packed immediate is already sign-extended
+    context.regs.D(instruction.reg) = static_cast<uint32_t>(instruction.immediate);
+
+    context.flags.setLogic(OperationSize::LONG, static_cast<uint32_t>(instruction.immediate));
+
+    return {};
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,61 @@
+#include <instruction_executor/effective_address.h>
+#include <instruction_executor/executors/MOVE_executor.h>
+#include <instruction_executor/operand_dispatch.h>
+
+namespace m68k::executors_ {
+
+namespace {
+
+template <AddressingMode Destination>
+constexpr bool isMoveDestination = Destination == AddressingMode::DATA_REGISTER || Destination == AddressingMode::ADDRESS ||
+                                   Destination == AddressingMode::ADDRESS_WITH_POSTINCREMENT ||
+                                   Destination == AddressingMode::ADDRESS_WITH_PREDECREMENT ||
+                                   Destination == AddressingMode::ADDRESS_WITH_DISPLACEMENT ||
+                                   Destination == AddressingMode::ADDRESS_WITH_INDEX ||
+                                   Destination == AddressingMode::ABSOLUTE_SHORT || Destination == AddressingMode::ABSOLUTE_LONG;
+
+/// Any source, but no byte moves from an address register
+template <OperationSize Size, AddressingMode Source>
+constexpr bool isMoveSource = Source != AddressingMode::NONE && !(Size == OperationSize::BYTE && Source == AddressingMode::ADDRESS_REGISTER);
+
+template <OperationSize Size, AddressingMode Source, AddressingMode Destination>
+struct MoveHandler {
+    static std::expected<void, ExecuteError> execute(ExecutionContext& context, const PackedInstruction& instruction)
+    {
+        if constexpr (!isMoveSource<Size, Source> || !isMoveDestination<Destination>) {
+            return std::unexpected(ExecuteError::INVALID_INSTRUCTION);
+        } else {
+            /// the source extension words follow the opcode, the destination ones follow them
+            const auto value = readOperand<Source, Size>(context, instruction.ea, context.instructionPc + 2);
+            if (!value) [[unlikely]] {
+                return std::unexpected(value.error());
+            }
+
+            const auto written = writeOperand<Destination, Size>(context, instruction.destinationEa, *value);
+            if (!written) [[unlikely]] {
+                return written;
+            }
+
+            context.flags.setLogic(Size, *value);
+            return {};
+        }
+    }
+};
+
+constexpr auto moveHandlers = makeOperandTable<MoveHandler>();
+
+} // namespace
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::MOVE>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    return dispatchOperands(moveHandlers, context, instruction);
+}
+
+template <>
+ExecutorFunction resolve<InstructionType::MOVE>(const PackedInstruction& instruction)
+{
+    return resolveOperands(moveHandlers, instruction);
+}
+
+} //namespace m68k::executors_
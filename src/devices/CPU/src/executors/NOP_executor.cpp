@@ -0,0 +1,11 @@
+#include <instruction_executor/executors/NOP_executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::NOP>(ExecutionContext& /*context*/, const PackedInstruction& /*instruction*/)
+{
+    return {};
+}
+
+} //namespace m68k::executors_
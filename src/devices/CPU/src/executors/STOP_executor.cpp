@@ -0,0 +1,21 @@
+#include <instruction_executor/executors/STOP_executor.h>
+#include <instruction_executor/status_register.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::STOP>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    if (!context.regs.SR().supervisorOrUserState()) {
+        return raiseException(context, ExceptionVector::PRIVILEGE_VIOLATION);
+    }
+
+    /// the new condition codes replace any pending ones
+    context.flags.materialize(context.regs.SR());
+    setStatusRegisterWord(context.regs, static_cast<uint16_t>(instruction.immediate));
+    context.statusRegisterWritten = true;
+    context.stopped = true;
+    return {};
+}
+
+} //namespace m68k::executors_
@@ -0,0 +1,12 @@
+#include <instruction_executor/executors/TRAP_executor.h>
+
+namespace m68k::executors_ {
+
+template <>
+std::expected<void, ExecuteError> execute<InstructionType::TRAP>(ExecutionContext& context, const PackedInstruction& instruction)
+{
+    /// TRAP #0-15 use vectors 32-47
+    return raiseException(context, static_cast<ExceptionVector>(static_cast<uint32_t>(ExceptionVector::TRAP_0) + static_cast<uint32_t>(instruction.immediate)));
+}
+
+} //namespace m68k::executors_
@@ -325,14 +325,14 @@ Instruction::Instruction(const InstructionData::LSL_Register_InstructionData& da
 }
 
 Instruction::Instruction(const InstructionData::LSR_Memory_InstructionData& data) :
-    type_(InstructionType::LSL_MEMORY)
+    type_(InstructionType::LSR_MEMORY)
     , data_(data)
 {
 
 }
 
 Instruction::Instruction(const InstructionData::LSR_Register_InstructionData& data) :
-    type_(InstructionType::LSL_REG)
+    type_(InstructionType::LSR_REG)
     , data_(data)
 {
 
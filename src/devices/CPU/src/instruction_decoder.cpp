@@ -1,3 +1,4 @@
+#include <array>
 #include <bus_helper/bus_helper.h>
 #include <instruction_decoder/instruction_decoder.h>
 #include <instructions/instruction_params.h>
@@ -104,14 +105,43 @@ namespace m68k {
 
 InstructionDecoder::InstructionDecoder(std::shared_ptr<DataExchange::MemoryInterface> bus) : 
                                     bus_(std::move(bus))
+                                    , codeWindow_(std::make_shared<CodeWindow>(bus_.get()))
                                     , typeDecoder_(std::make_unique<InstructionTypeDecoder>())
+                                    , decodeCache_(std::make_unique<DecodeCache>())
 {
     initDecoders();
+    if(bus_) {
+        bus_->addCodeWriteListener(decodeCache_.get());
+    }
+}
+
+InstructionDecoder::~InstructionDecoder()
+{
+    if(bus_) {
+        bus_->removeCodeWriteListener(decodeCache_.get());
+    }
 }
 
 std::expected<DecodeResult, DecodeError> InstructionDecoder::decode(uint32_t pc) //NOLINT(*-identifier-length)
 {
-    const auto readResult = m68k::busHelper::read<uint16_t>(*bus_, pc);
+    std::array<uint16_t, MAX_INSTRUCTION_WORDS> words{};
+    const size_t wordsCount = bus_ ? bus_->peekCodeWords(pc, words) : 0;
+
+    return decode(std::span<const uint16_t>(words.data(), wordsCount), pc);
+}
+
+std::expected<DecodeResult, DecodeError> InstructionDecoder::decode(std::span<const uint16_t> words, uint32_t pc) //NOLINT(*-identifier-length)
+{
+    codeWindow_->setWindow(words, pc & ~1U);
+    auto decodeResult = decodeFromWindow(pc);
+    codeWindow_->clearWindow();
+
+    return decodeResult;
+}
+
+std::expected<DecodeResult, DecodeError> InstructionDecoder::decodeFromWindow(uint32_t pc) //NOLINT(*-identifier-length)
+{
+    const auto readResult = m68k::busHelper::read<uint16_t>(*codeWindow_, pc);
     if(!readResult){
         return std::unexpected(DecodeError::MEMORY_READ_FAILURE);
     }
@@ -121,110 +151,169 @@ std::expected<DecodeResult, DecodeError> InstructionDecoder::decode(uint32_t pc)
         return std::unexpected(DecodeError::INVALID_INSTRUCTION);
     }
 
-    
-    return decoders_.at(static_cast<size_t>(instructionTypeResult.value()))->decode(readResult.value().data, pc);
+    const auto& decoder = decoders_[static_cast<size_t>(instructionTypeResult.value())];
+    if(!decoder) {
+        return std::unexpected(DecodeError::INVALID_INSTRUCTION);
+    }
+
+    return decoder->decode(readResult.value().data, pc);
+}
+
+std::expected<PackedInstruction, DecodeError> InstructionDecoder::decodePacked(uint32_t pc) //NOLINT(*-identifier-length)
+{
+    auto decodeResult = decode(pc);
+    if(!decodeResult) {
+        return std::unexpected(decodeResult.error());
+    }
+
+    return packInstruction(decodeResult->instruction, decodeResult->instructionSizeBytes);
+}
+
+std::expected<PackedInstruction, DecodeError> InstructionDecoder::decodePacked(std::span<const uint16_t> words, uint32_t pc) //NOLINT(*-identifier-length)
+{
+    auto decodeResult = decode(words, pc);
+    if(!decodeResult) {
+        return std::unexpected(decodeResult.error());
+    }
+
+    return packInstruction(decodeResult->instruction, decodeResult->instructionSizeBytes);
+}
+
+std::expected<PackedInstruction, DecodeError> InstructionDecoder::decodeCached(uint32_t pc) //NOLINT(*-identifier-length)
+{
+    if(!bus_) {
+        return decodePacked(pc);
+    }
+
+    if(const auto* cachedInstruction = decodeCache_->find(pc); cachedInstruction != nullptr) {
+        return *cachedInstruction;
+    }
+
+    auto decodeResult = decodePacked(pc);
+    if(!decodeResult) {
+        return std::unexpected(decodeResult.error());
+    }
+
+    /// extension words may lie in the next page
+    const uint32_t lastAddr = pc + decodeResult->lengthBytes - 1;
+    const auto firstPageType = bus_->codeMemoryType(pc);
+    const auto lastPageType = bus_->codeMemoryType(lastAddr);
+
+    if(firstPageType == DataExchange::CodeMemoryType::UNCACHEABLE || lastPageType == DataExchange::CodeMemoryType::UNCACHEABLE) {
+        return decodeResult;
+    }
+
+    if(firstPageType == DataExchange::CodeMemoryType::WRITABLE) {
+        bus_->watchCodeWrites(pc);
+    }
+    if(lastPageType == DataExchange::CodeMemoryType::WRITABLE) {
+        bus_->watchCodeWrites(lastAddr);
+    }
+
+    decodeCache_->insert(pc, decodeResult.value());
+    return decodeResult;
 }
 
 void InstructionDecoder::initDecoders()
 { 
-    decoders_.reserve(static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT));
-
-    decoders_[static_cast<size_t>(InstructionType::ORI_to_CCR)] = std::make_unique<decoders_::ORI_to_CCR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ORI_to_SR)] = std::make_unique<decoders_::ORI_to_SR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ORI)] = std::make_unique<decoders_::ORI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ANDI_to_CCR)] = std::make_unique<decoders_::ANDI_to_CCR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ANDI_to_SR)] = std::make_unique<decoders_::ANDI_to_SR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ANDI)] = std::make_unique<decoders_::ANDI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SUBI)] = std::make_unique<decoders_::SUBI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ADDI)] = std::make_unique<decoders_::ADDI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EORI_to_CCR)] = std::make_unique<decoders_::EORI_to_CCR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EORI_to_SR)] = std::make_unique<decoders_::EORI_to_SR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EORI)] = std::make_unique<decoders_::EORI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CMPI)] = std::make_unique<decoders_::CMPI_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BTST_IMMEDIATE)] = std::make_unique<decoders_::BTST_Immediate_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BTST_REGISTER)] = std::make_unique<decoders_::BTST_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BCHG_IMMEDIATE)] = std::make_unique<decoders_::BCHG_Immediate_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BCHG_REGISTER)] = std::make_unique<decoders_::BCHG_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BCLR_IMMEDIATE)] = std::make_unique<decoders_::BCLR_Immediate_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BCLR_REGISTER)] = std::make_unique<decoders_::BCLR_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BSET_IMMEDIATE)] = std::make_unique<decoders_::BSET_Immediate_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BSET_REGISTER)] = std::make_unique<decoders_::BSET_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVEP)] = std::make_unique<decoders_::MOVEP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVEA)] = std::make_unique<decoders_::MOVEA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVE)] = std::make_unique<decoders_::MOVE_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVE_from_SR)] = std::make_unique<decoders_::MOVE_from_SR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVE_to_CCR)] = std::make_unique<decoders_::MOVE_to_CCR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVE_to_SR)] = std::make_unique<decoders_::MOVE_to_SR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::NEGX)] = std::make_unique<decoders_::NEGX_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CLR)] = std::make_unique<decoders_::CLR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::NEG)] = std::make_unique<decoders_::NEG_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::NOT)] = std::make_unique<decoders_::NOT_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EXT)] = std::make_unique<decoders_::EXT_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::NBCD)] = std::make_unique<decoders_::NBCD_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SWAP)] = std::make_unique<decoders_::SWAP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::PEA)] = std::make_unique<decoders_::PEA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ILLEGAL)] = std::make_unique<decoders_::ILLEGAL_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::TAS)] = std::make_unique<decoders_::TAS_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::TST)] = std::make_unique<decoders_::TST_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::TRAP)] = std::make_unique<decoders_::TRAP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LINK)] = std::make_unique<decoders_::LINK_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::UNLK)] = std::make_unique<decoders_::UNLK_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVE_USP)] = std::make_unique<decoders_::MOVE_USP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::RESET)] = std::make_unique<decoders_::RESET_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::NOP)] = std::make_unique<decoders_::NOP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::STOP)] = std::make_unique<decoders_::STOP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::RTE)] = std::make_unique<decoders_::RTE_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::RTS)] = std::make_unique<decoders_::RTS_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::TRAPV)] = std::make_unique<decoders_::TRAPV_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::RTR)] = std::make_unique<decoders_::RTR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::JSR)] = std::make_unique<decoders_::JSR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::JMP)] = std::make_unique<decoders_::JMP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVEM)] = std::make_unique<decoders_::MOVEM_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LEA)] = std::make_unique<decoders_::LEA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CHK)] = std::make_unique<decoders_::CHK_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ADDQ)] = std::make_unique<decoders_::ADDQ_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SUBQ)] = std::make_unique<decoders_::SUBQ_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::Scc)] = std::make_unique<decoders_::Scc_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::DBcc)] = std::make_unique<decoders_::DBcc_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BRA)] = std::make_unique<decoders_::BRA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::BSR)] = std::make_unique<decoders_::BSR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::Bcc)] = std::make_unique<decoders_::Bcc_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MOVEQ)] = std::make_unique<decoders_::MOVEQ_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::DIVU)] = std::make_unique<decoders_::DIVU_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::DIVS)] = std::make_unique<decoders_::DIVS_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SBCD)] = std::make_unique<decoders_::SBCD_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::OR)] = std::make_unique<decoders_::OR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SUB)] = std::make_unique<decoders_::SUB_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SUBX)] = std::make_unique<decoders_::SUBX_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::SUBA)] = std::make_unique<decoders_::SUBA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EOR)] = std::make_unique<decoders_::EOR_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CMPM)] = std::make_unique<decoders_::CMPM_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CMP)] = std::make_unique<decoders_::CMP_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::CMPA)] = std::make_unique<decoders_::CMPA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MULU)] = std::make_unique<decoders_::MULU_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::MULS)] = std::make_unique<decoders_::MULS_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ABCD)] = std::make_unique<decoders_::ABCD_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::EXG)] = std::make_unique<decoders_::EXG_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::AND)] = std::make_unique<decoders_::AND_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ADD)] = std::make_unique<decoders_::ADD_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ADDX)] = std::make_unique<decoders_::ADDX_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ADDA)] = std::make_unique<decoders_::ADDA_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ASL_MEMORY)] = std::make_unique<decoders_::ASL_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ASL_REG)] = std::make_unique<decoders_::ASL_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ASR_MEMORY)] = std::make_unique<decoders_::ASR_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ASR_REG)] = std::make_unique<decoders_::ASR_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LSL_MEMORY)] = std::make_unique<decoders_::LSL_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LSL_REG)] = std::make_unique<decoders_::LSL_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LSR_MEMORY)] = std::make_unique<decoders_::LSR_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::LSR_REG)] = std::make_unique<decoders_::LSR_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROXL_MEMORY)] = std::make_unique<decoders_::ROXL_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROXL_REG)] = std::make_unique<decoders_::ROXL_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROXR_MEMORY)] = std::make_unique<decoders_::ROXR_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROXR_REG)] = std::make_unique<decoders_::ROXR_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROL_MEMORY)] = std::make_unique<decoders_::ROL_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROL_REG)] = std::make_unique<decoders_::ROL_Register_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROR_MEMORY)] = std::make_unique<decoders_::ROR_Memory_Decoder>(bus_);
-    decoders_[static_cast<size_t>(InstructionType::ROR_REG)] = std::make_unique<decoders_::ROR_Register_Decoder>(bus_);
+    decoders_.resize(static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT));
+
+    decoders_[static_cast<size_t>(InstructionType::ORI_to_CCR)] = std::make_unique<decoders_::ORI_to_CCR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ORI_to_SR)] = std::make_unique<decoders_::ORI_to_SR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ORI)] = std::make_unique<decoders_::ORI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ANDI_to_CCR)] = std::make_unique<decoders_::ANDI_to_CCR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ANDI_to_SR)] = std::make_unique<decoders_::ANDI_to_SR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ANDI)] = std::make_unique<decoders_::ANDI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SUBI)] = std::make_unique<decoders_::SUBI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ADDI)] = std::make_unique<decoders_::ADDI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EORI_to_CCR)] = std::make_unique<decoders_::EORI_to_CCR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EORI_to_SR)] = std::make_unique<decoders_::EORI_to_SR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EORI)] = std::make_unique<decoders_::EORI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CMPI)] = std::make_unique<decoders_::CMPI_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BTST_IMMEDIATE)] = std::make_unique<decoders_::BTST_Immediate_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BTST_REGISTER)] = std::make_unique<decoders_::BTST_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BCHG_IMMEDIATE)] = std::make_unique<decoders_::BCHG_Immediate_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BCHG_REGISTER)] = std::make_unique<decoders_::BCHG_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BCLR_IMMEDIATE)] = std::make_unique<decoders_::BCLR_Immediate_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BCLR_REGISTER)] = std::make_unique<decoders_::BCLR_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BSET_IMMEDIATE)] = std::make_unique<decoders_::BSET_Immediate_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BSET_REGISTER)] = std::make_unique<decoders_::BSET_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVEP)] = std::make_unique<decoders_::MOVEP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVEA)] = std::make_unique<decoders_::MOVEA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVE)] = std::make_unique<decoders_::MOVE_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVE_from_SR)] = std::make_unique<decoders_::MOVE_from_SR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVE_to_CCR)] = std::make_unique<decoders_::MOVE_to_CCR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVE_to_SR)] = std::make_unique<decoders_::MOVE_to_SR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::NEGX)] = std::make_unique<decoders_::NEGX_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CLR)] = std::make_unique<decoders_::CLR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::NEG)] = std::make_unique<decoders_::NEG_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::NOT)] = std::make_unique<decoders_::NOT_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EXT)] = std::make_unique<decoders_::EXT_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::NBCD)] = std::make_unique<decoders_::NBCD_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SWAP)] = std::make_unique<decoders_::SWAP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::PEA)] = std::make_unique<decoders_::PEA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ILLEGAL)] = std::make_unique<decoders_::ILLEGAL_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::TAS)] = std::make_unique<decoders_::TAS_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::TST)] = std::make_unique<decoders_::TST_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::TRAP)] = std::make_unique<decoders_::TRAP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LINK)] = std::make_unique<decoders_::LINK_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::UNLK)] = std::make_unique<decoders_::UNLK_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVE_USP)] = std::make_unique<decoders_::MOVE_USP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::RESET)] = std::make_unique<decoders_::RESET_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::NOP)] = std::make_unique<decoders_::NOP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::STOP)] = std::make_unique<decoders_::STOP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::RTE)] = std::make_unique<decoders_::RTE_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::RTS)] = std::make_unique<decoders_::RTS_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::TRAPV)] = std::make_unique<decoders_::TRAPV_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::RTR)] = std::make_unique<decoders_::RTR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::JSR)] = std::make_unique<decoders_::JSR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::JMP)] = std::make_unique<decoders_::JMP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVEM)] = std::make_unique<decoders_::MOVEM_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LEA)] = std::make_unique<decoders_::LEA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CHK)] = std::make_unique<decoders_::CHK_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ADDQ)] = std::make_unique<decoders_::ADDQ_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SUBQ)] = std::make_unique<decoders_::SUBQ_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::Scc)] = std::make_unique<decoders_::Scc_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::DBcc)] = std::make_unique<decoders_::DBcc_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BRA)] = std::make_unique<decoders_::BRA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::BSR)] = std::make_unique<decoders_::BSR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::Bcc)] = std::make_unique<decoders_::Bcc_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MOVEQ)] = std::make_unique<decoders_::MOVEQ_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::DIVU)] = std::make_unique<decoders_::DIVU_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::DIVS)] = std::make_unique<decoders_::DIVS_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SBCD)] = std::make_unique<decoders_::SBCD_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::OR)] = std::make_unique<decoders_::OR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SUB)] = std::make_unique<decoders_::SUB_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SUBX)] = std::make_unique<decoders_::SUBX_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::SUBA)] = std::make_unique<decoders_::SUBA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EOR)] = std::make_unique<decoders_::EOR_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CMPM)] = std::make_unique<decoders_::CMPM_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CMP)] = std::make_unique<decoders_::CMP_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::CMPA)] = std::make_unique<decoders_::CMPA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MULU)] = std::make_unique<decoders_::MULU_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::MULS)] = std::make_unique<decoders_::MULS_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ABCD)] = std::make_unique<decoders_::ABCD_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::EXG)] = std::make_unique<decoders_::EXG_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::AND)] = std::make_unique<decoders_::AND_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ADD)] = std::make_unique<decoders_::ADD_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ADDX)] = std::make_unique<decoders_::ADDX_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ADDA)] = std::make_unique<decoders_::ADDA_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ASL_MEMORY)] = std::make_unique<decoders_::ASL_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ASL_REG)] = std::make_unique<decoders_::ASL_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ASR_MEMORY)] = std::make_unique<decoders_::ASR_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ASR_REG)] = std::make_unique<decoders_::ASR_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LSL_MEMORY)] = std::make_unique<decoders_::LSL_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LSL_REG)] = std::make_unique<decoders_::LSL_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LSR_MEMORY)] = std::make_unique<decoders_::LSR_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::LSR_REG)] = std::make_unique<decoders_::LSR_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROXL_MEMORY)] = std::make_unique<decoders_::ROXL_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROXL_REG)] = std::make_unique<decoders_::ROXL_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROXR_MEMORY)] = std::make_unique<decoders_::ROXR_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROXR_REG)] = std::make_unique<decoders_::ROXR_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROL_MEMORY)] = std::make_unique<decoders_::ROL_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROL_REG)] = std::make_unique<decoders_::ROL_Register_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROR_MEMORY)] = std::make_unique<decoders_::ROR_Memory_Decoder>(codeWindow_);
+    decoders_[static_cast<size_t>(InstructionType::ROR_REG)] = std::make_unique<decoders_::ROR_Register_Decoder>(codeWindow_);
 }
 
 
@@ -0,0 +1,111 @@
+#include "cpu/lockstep_validator.h"
+#include <bus_helper/bus_helper.h>
+#include <cstddef>
+#include <instruction_decoder/basic_block.h>
+#include <utility>
+
+namespace m68k {
+
+namespace {
+
+/// A block's instructions and the interrupt taken before it
+constexpr size_t MAX_REFERENCE_CALLS = BasicBlock::MAX_INSTRUCTIONS + 1;
+
+} // namespace
+
+LockstepValidator::LockstepValidator(std::shared_ptr<DataExchange::MemoryInterface> primaryBus,
+                                     std::shared_ptr<DataExchange::MemoryInterface> referenceBus) :
+    primaryBus_(std::move(primaryBus)),
+    referenceBus_(std::move(referenceBus)),
+    primary_(primaryBus_),
+    reference_(referenceBus_)
+{
+
+}
+
+std::expected<void, CPUError> LockstepValidator::reset()
+{
+    const auto primaryResult = primary_.reset();
+    const auto referenceResult = reference_.reset();
+    return primaryResult ? referenceResult : primaryResult;
+}
+
+std::expected<void, LockstepError> LockstepValidator::step()
+{
+    const uint32_t blockPc = primary_.registers().PC();
+    if(!primary_.executeBlock()) {
+        return std::unexpected(LockstepError::PRIMARY_FAILED);
+    }
+
+    for(size_t call = 0; call < MAX_REFERENCE_CALLS && reference_.steps() < primary_.steps(); ++call) {
+        if(!reference_.executeNextInstruction()) {
+            return std::unexpected(LockstepError::REFERENCE_FAILED);
+        }
+    }
+
+    if(reference_.steps() != primary_.steps()) {
+        return diverged(LockstepError::STEPS_DIFFER, blockPc);
+    }
+
+    if(primary_.registers() != reference_.registers()) {
+        return diverged(LockstepError::REGISTERS_DIFFER, blockPc);
+    }
+
+    for(const auto& range : comparedRanges_) {
+        for(uint32_t address = range.start; address - range.start < range.length; ++address) {
+            const auto primaryByte = busHelper::read<uint8_t>(*primaryBus_, address);
+            const auto referenceByte = busHelper::read<uint8_t>(*referenceBus_, address);
+            if(primaryByte.has_value() != referenceByte.has_value() || (primaryByte && primaryByte->data != referenceByte->data)) {
+                return diverged(LockstepError::MEMORY_DIFFERS, blockPc, address);
+            }
+        }
+    }
+
+    return {};
+}
+
+void LockstepValidator::compareMemory(uint32_t start, uint32_t length)
+{
+    comparedRanges_.push_back(MemoryRange{.start = start, .length = length});
+}
+
+void LockstepValidator::raiseIPL(uint8_t level)
+{
+    primary_.interruptController().raiseIPL(level);
+    reference_.interruptController().raiseIPL(level);
+}
+
+void LockstepValidator::lowerIPL(uint8_t level)
+{
+    primary_.interruptController().lowerIPL(level);
+    reference_.interruptController().lowerIPL(level);
+}
+
+CPU& LockstepValidator::primary()
+{
+    return primary_;
+}
+
+CPU& LockstepValidator::reference()
+{
+    return reference_;
+}
+
+const LockstepDivergence& LockstepValidator::divergence() const
+{
+    return divergence_;
+}
+
+std::expected<void, LockstepError> LockstepValidator::diverged(LockstepError error, uint32_t blockPc, uint32_t address)
+{
+    divergence_ = LockstepDivergence{
+        .blockPc = blockPc,
+        .steps = primary_.steps(),
+        .primary = primary_.registers(),
+        .reference = reference_.registers(),
+        .address = address
+    };
+    return std::unexpected(error);
+}
+
+} // namespace m68k
@@ -0,0 +1,344 @@
+#include <instruction_decoder/native_translator.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/**
+ * @file native_translator.cpp
+ * @brief translateNative() for x86-64 System V hosts, built with M68K_X86_64_JIT.
+ *
+ * Generated functions follow the System V calling convention: the data registers arrive
+ * in RDI, the condition codes leave in EAX, and only caller-saved registers are used,
+ * so there is no prologue or epilogue beyond the register loads and stores.
+ */
+
+namespace m68k {
+
+namespace {
+
+//NOLINTBEGIN(*-magic-numbers)
+
+enum HostRegister : uint8_t {
+    RAX = 0,
+    RCX = 1,
+    RDX = 2,
+    RSI = 6,
+    RDI = 7,
+    R8 = 8,
+    R9 = 9,
+    R10 = 10,
+    R11 = 11
+};
+
+/// Host registers the data registers are kept in; RDI holds &Registers::D(0), EAX the result
+constexpr std::array<HostRegister, 7> CACHE_REGISTERS = {RSI, RDX, RCX, R8, R9, R10, R11};
+
+constexpr uint8_t REX = 0x40;
+constexpr uint8_t REX_R = 0x04;
+constexpr uint8_t REX_B = 0x01;
+constexpr uint8_t OPERAND_SIZE_PREFIX = 0x66;
+
+/// The few x86-64 instructions the translator needs, register operands only
+class Emitter {
+public:
+    explicit Emitter(std::vector<uint8_t>& code) : code_(code) {}
+
+    /// mov r32, [rdi + index * 4]
+    void loadDataRegister(HostRegister host, uint8_t index)
+    {
+        rexIfNeeded(host, RDI);
+        emit(0x8B, modRm(0b01, host, RDI), static_cast<uint8_t>(index * 4));
+    }
+
+    /// mov [rdi + index * 4], r32
+    void storeDataRegister(uint8_t index, HostRegister host)
+    {
+        rexIfNeeded(host, RDI);
+        emit(0x89, modRm(0b01, host, RDI), static_cast<uint8_t>(index * 4));
+    }
+
+    /// mov r8/r16/r32, imm; narrower moves leave the upper bits alone like 68000 ones
+    void moveImmediate(OperationSize size, HostRegister destination, uint32_t value)
+    {
+        switch (size) {
+        case OperationSize::BYTE:
+            /// a REX prefix selects SIL rather than DH
+            emit(static_cast<uint8_t>(REX | rexB(destination)), static_cast<uint8_t>(0xB0 + (destination & 7U)), static_cast<uint8_t>(value));
+            break;
+        case OperationSize::WORD:
+            emit(OPERAND_SIZE_PREFIX);
+            rexIfNeeded(RAX, destination);
+            emit(static_cast<uint8_t>(0xB8 + (destination & 7U)));
+            emitLittleEndian(value, 2);
+            break;
+        case OperationSize::LONG:
+            rexIfNeeded(RAX, destination);
+            emit(static_cast<uint8_t>(0xB8 + (destination & 7U)));
+            emitLittleEndian(value, 4);
+            break;
+        }
+    }
+
+    /// mov r8/r16/r32, r8/r16/r32
+    void moveRegister(OperationSize size, HostRegister destination, HostRegister source)
+    {
+        registerToRegister(size, 0x88, 0x89, destination, source);
+    }
+
+    /// test r8/r16/r32, r8/r16/r32
+    void test(OperationSize size, HostRegister host)
+    {
+        registerToRegister(size, 0x84, 0x85, host, host);
+    }
+
+    /// eax = N and Z from EFLAGS in their SR positions, then ret
+    void returnNegativeAndZero()
+    {
+        emit(0x0F, 0x98, 0xC0);     ///< sets al
+        emit(0x0F, 0x94, 0xC2);     ///< setz dl
+        emit(0x0F, 0xB6, 0xC0);     ///< movzx eax, al
+        emit(0x0F, 0xB6, 0xD2);     ///< movzx edx, dl
+        emit(0xC1, 0xE0, 3);        ///< shl eax, 3
+        emit(0xC1, 0xE2, 2);        ///< shl edx, 2
+        emit(0x09, 0xD0);           ///< or eax, edx
+        emit(0xC3);                 ///< ret
+    }
+
+    /// xor eax, eax; ret
+    void returnZero()
+    {
+        emit(0x31, 0xC0, 0xC3);
+    }
+
+private:
+    static constexpr uint8_t rexR(HostRegister reg) { return (reg & 8U) != 0 ? REX_R : 0; }
+    static constexpr uint8_t rexB(HostRegister reg) { return (reg & 8U) != 0 ? REX_B : 0; }
+
+    static constexpr uint8_t modRm(uint8_t mod, HostRegister reg, HostRegister rm)
+    {
+        return static_cast<uint8_t>((mod << 6U) | ((reg & 7U) << 3U) | (rm & 7U));
+    }
+
+    void rexIfNeeded(HostRegister reg, HostRegister rm)
+    {
+        if (const uint8_t bits = rexR(reg) | rexB(rm); bits != 0) {
+            emit(static_cast<uint8_t>(REX | bits));
+        }
+    }
+
+    void registerToRegister(OperationSize size, uint8_t byteOpcode, uint8_t opcode, HostRegister rm, HostRegister reg)
+    {
+        if (size == OperationSize::BYTE) {
+            emit(static_cast<uint8_t>(REX | rexR(reg) | rexB(rm)), byteOpcode, modRm(0b11, reg, rm));
+            return;
+        }
+        if (size == OperationSize::WORD) {
+            emit(OPERAND_SIZE_PREFIX);
+        }
+        rexIfNeeded(reg, rm);
+        emit(opcode, modRm(0b11, reg, rm));
+    }
+
+    template <typename... Bytes>
+    void emit(Bytes... bytes)
+    {
+        (code_.push_back(static_cast<uint8_t>(bytes)), ...);
+    }
+
+    void emitLittleEndian(uint32_t value, unsigned bytes)
+    {
+        for (unsigned i = 0; i < bytes; ++i) {
+            code_.push_back(static_cast<uint8_t>(value >> (8U * i)));
+        }
+    }
+
+    std::vector<uint8_t>& code_;
+};
+
+//NOLINTEND(*-magic-numbers)
+
+bool isNativeInstruction(const PackedInstruction& instruction)
+{
+    switch (instruction.type) {
+    case InstructionType::NOP:
+    case InstructionType::MOVEQ:
+        return true;
+    case InstructionType::MOVE:
+        return (instruction.ea.mode == AddressingMode::DATA_REGISTER || instruction.ea.mode == AddressingMode::IMMEDIATE) &&
+               instruction.destinationEa.mode == AddressingMode::DATA_REGISTER;
+    default:
+        return false;
+    }
+}
+
+/// Host register of every data register a segment uses
+class RegisterMap {
+public:
+    /// Host register of dataRegister, allocated on first use; nothing when all are taken
+    std::optional<HostRegister> allocate(uint8_t dataRegister)
+    {
+        if (!hosts_.at(dataRegister)) {
+            if (used_ == CACHE_REGISTERS.size()) {
+                return std::nullopt;
+            }
+            hosts_.at(dataRegister) = CACHE_REGISTERS.at(used_++);
+        }
+        return hosts_.at(dataRegister);
+    }
+
+    [[nodiscard]] HostRegister host(uint8_t dataRegister) const { return *hosts_.at(dataRegister); }
+    [[nodiscard]] bool used(uint8_t dataRegister) const { return hosts_.at(dataRegister).has_value(); }
+
+private:
+    std::array<std::optional<HostRegister>, 8> hosts_{};    //NOLINT(*-magic-numbers)
+    size_t used_ = 0;
+};
+
+/// Data registers an instruction reads or writes
+void collectRegisters(const PackedInstruction& instruction, std::array<uint8_t, 2>& registers, size_t& count)
+{
+    count = 0;
+    if (instruction.type == InstructionType::MOVEQ) {
+        registers.at(count++) = instruction.reg;
+    } else if (instruction.type == InstructionType::MOVE) {
+        if (instruction.ea.mode == AddressingMode::DATA_REGISTER) {
+            registers.at(count++) = instruction.ea.reg;
+        }
+        registers.at(count++) = instruction.destinationEa.reg;
+    }
+}
+
+/**
+ * @brief Emit one segment, all of its instructions native and their registers mapped.
+ * @return Whether it sets the condition codes.
+ */
+bool emitSegment(Emitter& emitter, std::span<const PackedInstruction> instructions, const RegisterMap& registers)
+{
+    for (uint8_t reg = 0; reg < 8; ++reg) { //NOLINT(*-magic-numbers)
+        if (registers.used(reg)) {
+            emitter.loadDataRegister(registers.host(reg), reg);
+        }
+    }
+
+    std::array<bool, 8> written{};  //NOLINT(*-magic-numbers)
+    std::optional<std::pair<OperationSize, HostRegister>> lastResult;
+    for (const auto& instruction : instructions) {
+        if (instruction.type == InstructionType::MOVEQ) {
+            /// the packed immediate is already sign-extended
+            emitter.moveImmediate(OperationSize::LONG, registers.host(instruction.reg), static_cast<uint32_t>(instruction.immediate));
+            written.at(instruction.reg) = true;
+            lastResult = {OperationSize::LONG, registers.host(instruction.reg)};
+        } else if (instruction.type == InstructionType::MOVE) {
+            const auto destination = registers.host(instruction.destinationEa.reg);
+            if (instruction.ea.mode == AddressingMode::IMMEDIATE) {
+                emitter.moveImmediate(instruction.size, destination, instruction.ea.extension());
+            } else {
+                emitter.moveRegister(instruction.size, destination, registers.host(instruction.ea.reg));
+            }
+            written.at(instruction.destinationEa.reg) = true;
+            lastResult = {instruction.size, destination};
+        }
+    }
+
+    for (uint8_t reg = 0; reg < 8; ++reg) { //NOLINT(*-magic-numbers)
+        if (written.at(reg)) {
+            emitter.storeDataRegister(reg, registers.host(reg));
+        }
+    }
+
+    /// the moved value is still in its destination register, stored or not
+    if (lastResult) {
+        emitter.test(lastResult->first, lastResult->second);
+        emitter.returnNegativeAndZero();
+        return true;
+    }
+    emitter.returnZero();
+    return false;
+}
+
+/// Read-only executable copy of code, unmapped when the last reference goes
+std::shared_ptr<const void> makeExecutable(const std::vector<uint8_t>& code)
+{
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t mappedSize = (code.size() + pageSize - 1) / pageSize * pageSize;
+
+    void* memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return nullptr;
+    }
+    std::memcpy(memory, code.data(), code.size());
+    if (mprotect(memory, mappedSize, PROT_READ | PROT_EXEC) != 0) {
+        munmap(memory, mappedSize);
+        return nullptr;
+    }
+
+    return {memory, [mappedSize](const void* mapped) { munmap(const_cast<void*>(mapped), mappedSize); }}; //NOLINT(*-const-cast)
+}
+
+} // namespace
+
+void translateNative(BasicBlock& block)
+{
+    const auto& instructions = block.instructions;
+    std::vector<uint8_t> code;
+    Emitter emitter(code);
+    /// code offsets until the code has its final address
+    std::vector<std::pair<size_t, size_t>> entries;
+    std::vector<NativeSegment> segments(instructions.size());
+
+    for (size_t first = 0; first < instructions.size();) {
+        RegisterMap registers;
+        size_t last = first;
+        for (; last < instructions.size() && isNativeInstruction(instructions[last]); ++last) {
+            std::array<uint8_t, 2> used{};
+            size_t usedCount = 0;
+            collectRegisters(instructions[last], used, usedCount);
+            bool allocated = true;
+            for (size_t i = 0; i < usedCount; ++i) {
+                allocated = allocated && registers.allocate(used.at(i)).has_value();
+            }
+            if (!allocated) {
+                break;
+            }
+        }
+
+        if (last - first < MIN_NATIVE_INSTRUCTIONS) {
+            first = std::max(last, first + 1);
+            continue;
+        }
+
+        auto& segment = segments[first];
+        segment.instructionsCount = static_cast<uint8_t>(last - first);
+        for (size_t i = first; i < last; ++i) {
+            segment.lengthBytes = static_cast<uint16_t>(segment.lengthBytes + instructions[i].lengthBytes);
+            segment.cycles += instructions[i].cycles;
+        }
+        segment.cyclesBeforeLast = segment.cycles - instructions[last - 1].cycles;
+
+        entries.emplace_back(first, code.size());
+        segment.setsFlags = emitSegment(emitter, std::span(instructions).subspan(first, last - first), registers);
+        first = last;
+    }
+
+    if (entries.empty()) {
+        return;
+    }
+    auto nativeCode = makeExecutable(code);
+    if (!nativeCode) {
+        return;
+    }
+
+    for (const auto& [index, offset] : entries) {
+        segments[index].entry = reinterpret_cast<NativeFunction>(static_cast<const uint8_t*>(nativeCode.get()) + offset); //NOLINT(*-reinterpret-cast)
+    }
+    block.nativeSegments = std::move(segments);
+    block.nativeCode = std::move(nativeCode);
+}
+
+} // namespace m68k
@@ -0,0 +1,304 @@
+#include <cstddef>
+#include <instructions/instruction_timing.h>
+#include <instructions/packed_instruction.h>
+#include <type_traits>
+#include <variant>
+
+namespace m68k {
+
+namespace {
+
+constexpr PackedEffectiveAddress makeEffectiveAddress(AddressingMode mode, uint8_t reg, uint32_t extension = 0)
+{
+    PackedEffectiveAddress effectiveAddress{.mode = mode, .reg = reg};
+    effectiveAddress.setExtension(extension);
+    return effectiveAddress;
+}
+
+constexpr uint32_t packBriefExtensionWord(const IndexedMode::BriefExtensionWord& extensionWord)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    uint32_t word = static_cast<uint8_t>(extensionWord.displacement);
+    word |= static_cast<uint32_t>(extensionWord.registerNum) << 12U;
+    if (extensionWord.registerType == IndexedMode::RegisterType::ADDRESS_REGISTER) {
+        word |= 0x8000U;
+    }
+    if (extensionWord.indexSize == IndexedMode::IndexSize::LONG) {
+        word |= 0x0800U;
+    }
+    //NOLINTEND(*-magic-numbers)
+    return word;
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const DataRegisterModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::DATA_REGISTER, data.dataRegNum);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressRegisterModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS_REGISTER, data.addressRegNum);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS, data.addressRegNum);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressWithPostincrementModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS_WITH_POSTINCREMENT, data.addressRegNum);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressWithPredecrementModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS_WITH_PREDECREMENT, data.addressRegNum);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressWithDisplacementModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS_WITH_DISPLACEMENT, data.addressRegNum,
+                                static_cast<uint32_t>(static_cast<int32_t>(data.displacement)));
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AddressWithIndexModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ADDRESS_WITH_INDEX, data.addressRegNum, packBriefExtensionWord(data.extensionWord));
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const ProgramCounterWithDisplacementModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::PC_WITH_DISPLACEMENT, 0, static_cast<uint32_t>(static_cast<int32_t>(data.displacement)));
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const ProgramCounterWithIndexModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::PC_WITH_INDEX, 0, packBriefExtensionWord(data.extensionWord));
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AbsoluteShortModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ABSOLUTE_SHORT, 0, static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(data.address))));
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const AbsoluteLongModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::ABSOLUTE_LONG, 0, data.address);
+}
+
+constexpr PackedEffectiveAddress packEffectiveAddress(const ImmediateModeData& data)
+{
+    return makeEffectiveAddress(AddressingMode::IMMEDIATE, 0, std::visit([](auto value) { return static_cast<uint32_t>(value); }, data.immediateData));
+}
+
+template <typename Variant>
+constexpr PackedEffectiveAddress packEffectiveAddressVariant(const Variant& data)
+{
+    return std::visit([](const auto& modeData) { return packEffectiveAddress(modeData); }, data);
+}
+
+/// Immediate fields are either plain integers or a variant of their possible widths
+template <typename Value>
+constexpr int32_t toImmediate(const Value& value)
+{
+    if constexpr (requires { std::visit([](auto) {}, value); }) {
+        return std::visit([](auto alternative) { return static_cast<int32_t>(alternative); }, value);
+    } else {
+        return static_cast<int32_t>(value);
+    }
+}
+
+/// Register of the data struct named by the opcode, under the names the instruction data structs use
+/// @return Fields of data stored
+template <typename DataType>
+constexpr size_t packRegister(PackedInstruction& packed, const DataType& data)
+{
+    if constexpr (requires { data.dataRegNumber; }) {
+        packed.reg = data.dataRegNumber;
+        if constexpr (requires { data.addrRegNumber; }) {
+            /// MOVEP: Dx and Ay
+            packed.reg2 = data.addrRegNumber;
+            return 2;
+        }
+        return 1;
+    } else if constexpr (requires { data.dataRegisterNumber; }) {
+        packed.reg = data.dataRegisterNumber;
+        return 1;
+    } else if constexpr (requires { data.addrRegNumber; }) {
+        packed.reg = data.addrRegNumber;
+        return 1;
+    } else if constexpr (requires { data.addrRegisterNumber; }) {
+        packed.reg = data.addrRegisterNumber;
+        return 1;
+    } else if constexpr (requires { data.addressRegisterNumber; }) {
+        packed.reg = data.addressRegisterNumber;
+        return 1;
+    } else if constexpr (requires { data.destinationAddressRegister; }) {
+        packed.reg = data.destinationAddressRegister;
+        return 1;
+    } else if constexpr (requires { data.destinationDataRegister; }) {
+        packed.reg = data.destinationDataRegister;
+        return 1;
+    } else if constexpr (requires { data.registerNumber; }) {
+        packed.reg = data.registerNumber;
+        return 1;
+    } else if constexpr (requires { data.regNumber; }) {
+        packed.reg = data.regNumber;
+        return 1;
+    } else if constexpr (requires { data.destinationRegister; }) {
+        packed.reg = data.destinationRegister;
+        packed.reg2 = data.sourceRegister;
+        return 2;
+    } else if constexpr (requires { data.destinationRegisterNumber; }) {
+        packed.reg = data.destinationRegisterNumber;
+        packed.reg2 = data.sourceRegisterNumber;
+        return 2;
+    } else if constexpr (requires { data.registerRx; }) {
+        packed.reg = data.registerRx;
+        packed.reg2 = data.registerRy;
+        return 2;
+    } else if constexpr (requires { data.dataRegisterToBeShifted; }) {
+        packed.reg = data.dataRegisterToBeShifted;
+        packed.reg2 = data.countOrRegister;
+        return 2;
+    } else if constexpr (requires { data.dataRegisterToBeRotated; }) {
+        packed.reg = data.dataRegisterToBeRotated;
+        packed.reg2 = data.countOrRegister;
+        return 2;
+    } else {
+        return 0;
+    }
+}
+
+/// @return Fields of data stored
+template <typename DataType>
+constexpr size_t packParam(PackedInstruction& packed, const DataType& data)
+{
+    if constexpr (requires { data.condition; }) {
+        packed.param = static_cast<uint8_t>(data.condition);
+    } else if constexpr (requires { data.destOperandType; }) {
+        packed.param = static_cast<uint8_t>(data.destOperandType);
+    } else if constexpr (requires { data.operandAddressingMode; }) {
+        packed.param = static_cast<uint8_t>(data.operandAddressingMode);
+    } else if constexpr (requires { data.direction; }) {
+        packed.param = static_cast<uint8_t>(data.direction);
+    } else if constexpr (requires { data.opMode; }) {
+        packed.param = static_cast<uint8_t>(data.opMode);
+    } else if constexpr (requires { data.mode; }) {
+        packed.param = static_cast<uint8_t>(data.mode);
+    } else if constexpr (requires { data.shiftMode; }) {
+        packed.param = static_cast<uint8_t>(data.shiftMode);
+    } else if constexpr (requires { data.rotateMode; }) {
+        packed.param = static_cast<uint8_t>(data.rotateMode);
+    } else if constexpr (requires { data.exchangeType; }) {
+        packed.param = static_cast<uint8_t>(data.exchangeType);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/// @return Fields of data stored
+template <typename DataType>
+constexpr size_t packImmediate(PackedInstruction& packed, const DataType& data)
+{
+    if constexpr (requires { data.immediateData; }) {
+        packed.immediate = toImmediate(data.immediateData);
+    } else if constexpr (requires { data.displacement; }) {
+        packed.immediate = toImmediate(data.displacement);
+    } else if constexpr (requires { data.data; }) {
+        packed.immediate = toImmediate(data.data);
+    } else if constexpr (requires { data.registerMask; }) {
+        packed.immediate = data.registerMask;
+    } else if constexpr (requires { data.bitNumber; }) {
+        packed.immediate = data.bitNumber;
+    } else if constexpr (requires { data.vectorNumber; }) {
+        packed.immediate = data.vectorNumber;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/// @return Fields of data stored
+template <typename DataType>
+constexpr size_t packEffectiveAddresses(PackedInstruction& packed, const DataType& data)
+{
+    if constexpr (requires { data.addressingModeData; }) {
+        packed.ea = packEffectiveAddressVariant(data.addressingModeData);
+        return 1;
+    } else if constexpr (requires { data.sourceOperand; }) {
+        packed.ea = packEffectiveAddressVariant(data.sourceOperand);
+        return 1;
+    } else if constexpr (requires { data.operandToBeShifted; }) {
+        packed.ea = packEffectiveAddressVariant(data.operandToBeShifted);
+        return 1;
+    } else if constexpr (requires { data.sourceAddressingModeData; }) {
+        packed.ea = packEffectiveAddressVariant(data.sourceAddressingModeData);
+        packed.destinationEa = packEffectiveAddressVariant(data.destinationAddressingModeData);
+        return 2;
+    } else {
+        return 0;
+    }
+}
+
+/// @return Fields of data stored
+template <typename DataType>
+constexpr size_t packFields(PackedInstruction& packed, const DataType& data)
+{
+    size_t fields = 0;
+    if constexpr (requires { data.size; }) {
+        packed.size = data.size;
+        ++fields;
+    }
+    fields += packRegister(packed, data);
+    fields += packParam(packed, data);
+    fields += packImmediate(packed, data);
+    fields += packEffectiveAddresses(packed, data);
+    return fields;
+}
+
+/// Converts to the type of any field, to count the fields of an instruction data struct
+struct AnyField {
+    template <typename FieldType>
+    constexpr operator FieldType() const; //NOLINT(google-explicit-constructor)
+};
+
+/// Number of fields of an instruction data aggregate: the most initializers it accepts
+template <typename DataType, typename... Fields>
+constexpr size_t fieldsCount()
+{
+    if constexpr (requires { DataType{Fields{}..., AnyField{}}; }) {
+        return fieldsCount<DataType, Fields..., AnyField>();
+    } else {
+        return sizeof...(Fields);
+    }
+}
+
+/// Whether packFields() stores every field of DataType, evaluated at compile time
+template <typename DataType>
+constexpr bool packsAllFields()
+{
+    PackedInstruction packed{};
+    return packFields(packed, DataType{}) == fieldsCount<DataType>();
+}
+
+} // namespace
+
+PackedInstruction packInstruction(const Instruction& instruction, uint32_t lengthBytes)
+{
+    PackedInstruction packed{};
+    packed.type = instruction.type();
+    packed.lengthBytes = static_cast<uint8_t>(lengthBytes);
+
+    std::visit([&packed](const auto& data) {
+        using DataType = std::remove_cvref_t<decltype(data)>;
+        static_assert(packsAllFields<DataType>(), "instruction data has a field packFields() does not store");
+        packFields(packed, data);
+    }, instruction.dataVariant());
+
+    packed.cycles = timing::instructionCycles(packed);
+    return packed;
+}
+
+} // namespace m68k
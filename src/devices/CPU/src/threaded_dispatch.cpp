@@ -0,0 +1,106 @@
+#include "cpu/cpu.h"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <instruction_executor/executor_table.h>
+#include <instruction_executor/executors/BRA_executor.h>
+#include <instruction_executor/executors/Bcc_executor.h>
+#include <instruction_executor/executors/DBcc_executor.h>
+#include <instruction_executor/executors/ILLEGAL_executor.h>
+#include <instruction_executor/executors/MOVE_executor.h>
+#include <instruction_executor/executors/MOVEQ_executor.h>
+#include <instruction_executor/executors/NOP_executor.h>
+#include <instruction_executor/executors/STOP_executor.h>
+#include <instruction_executor/executors/TRAP_executor.h>
+#include <utility>
+
+/**
+ * @file threaded_dispatch.cpp
+ * @brief Direct-threaded CPU::runInstructions(), built with M68K_THREADED_DISPATCH.
+ *
+ * Uses the GCC/Clang labels-as-values extension: every implemented instruction type has
+ * its own label that calls its executor directly and jumps straight to the handler of the
+ * next predecoded instruction. Each handler thus ends with its own indirect jump, and the
+ * branch predictor learns which instruction tends to follow which. Types without an
+ * executor go through the generic handler and the dispatch table. Translated blocks
+ * run the same way: their labels already call the executors without the type table.
+ */
+
+namespace m68k {
+
+/// Instruction types with their own handler; keep in sync with the executors
+#define M68K_THREADED_INSTRUCTIONS(HANDLER) \
+    HANDLER(NOP)                            \
+    HANDLER(MOVE)                           \
+    HANDLER(MOVEQ)                          \
+    HANDLER(BRA)                            \
+    HANDLER(Bcc)                            \
+    HANDLER(DBcc)                           \
+    HANDLER(ILLEGAL)                        \
+    HANDLER(TRAP)                           \
+    HANDLER(STOP)
+
+std::expected<int64_t, CPUError> CPU::runInstructions(const BasicBlock& block, int64_t budget)
+{
+#define M68K_DISPATCH_ENTRY(TYPE) {InstructionType::TYPE, &&TYPE##_handler},
+
+    using DispatchTable = std::array<const void*, static_cast<size_t>(InstructionType::INSTRUCTIONS_COUNT)>;
+    static const DispatchTable dispatchTable = [](const void* generic, std::initializer_list<std::pair<InstructionType, const void*>> handlers) {
+        DispatchTable table{};
+        table.fill(generic);
+        for(const auto& [type, handler] : handlers) {
+            table[static_cast<size_t>(type)] = handler; //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        return table;
+    }(&&generic_handler, {M68K_THREADED_INSTRUCTIONS(M68K_DISPATCH_ENTRY)});
+
+#undef M68K_DISPATCH_ENTRY
+
+    const PackedInstruction* instruction = block.instructions.data();
+    const PackedInstruction* const end = instruction + block.instructions.size();
+    uint32_t instructionPc = block.startPc;
+    uint32_t nextPc = block.startPc;
+    int64_t usedCycles = 0;
+
+    /// same exits as the portable loop: a left straight-line path, the budget, a stop or an SR write
+#define M68K_DISPATCH_NEXT()                                                                            \
+    if(usedCycles >= budget || stopRequested_ || endBatch_ || ++instruction == end ||                   \
+       regs_.PC() != nextPc || !block.valid) {                                                          \
+        return usedCycles;                                                                              \
+    }                                                                                                   \
+    instructionPc = nextPc;                                                                             \
+    nextPc += instruction->lengthBytes;                                                                 \
+    regs_.PC() = nextPc;                                                                                \
+    goto *dispatchTable[static_cast<size_t>(instruction->type)] //NOLINT
+
+#define M68K_HANDLER(TYPE, EXECUTE)                                                                     \
+    TYPE##_handler: {                                                                                   \
+        executors_::ExecutionContext context{.regs = regs_, .bus = *bus_, .flags = flags_, .instructionPc = instructionPc}; \
+        const auto instructionCycles = completeInstruction(*instruction, context, EXECUTE(context, *instruction)); \
+        if(!instructionCycles) [[unlikely]] {                                                           \
+            return instructionCycles;                                                                   \
+        }                                                                                               \
+        usedCycles += *instructionCycles;                                                               \
+        M68K_DISPATCH_NEXT();                                                                           \
+    }
+
+#define M68K_TYPED_HANDLER(TYPE) M68K_HANDLER(TYPE, executors_::execute<InstructionType::TYPE>)
+
+    if(instruction == end || regs_.PC() != nextPc || !block.valid) {
+        return usedCycles;
+    }
+    nextPc += instruction->lengthBytes;
+    regs_.PC() = nextPc;
+    goto *dispatchTable[static_cast<size_t>(instruction->type)]; //NOLINT
+
+    M68K_THREADED_INSTRUCTIONS(M68K_TYPED_HANDLER)
+    M68K_HANDLER(generic, executors_::executeInstruction)
+
+#undef M68K_TYPED_HANDLER
+#undef M68K_HANDLER
+#undef M68K_DISPATCH_NEXT
+}
+
+#undef M68K_THREADED_INSTRUCTIONS
+
+} // namespace m68k
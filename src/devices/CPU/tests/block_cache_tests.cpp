@@ -0,0 +1,282 @@
+#include <array>
+#include <cpu/internal/instruction_decoder/block_cache.h>
+#include <cpu/internal/instruction_decoder/instruction_decoder.h>
+#include <cpu/internal/instruction_executor/executor_table.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+//NOLINTBEGIN(*-magic-numbers)
+constexpr uint16_t NOP_OPCODE = 0x4E71;
+constexpr uint16_t MOVEQ_OPCODE = 0x7001;
+constexpr uint16_t BRA_OPCODE = 0x6002;
+constexpr uint16_t LINE_F_OPCODE = 0xFFFF;
+//NOLINTEND(*-magic-numbers)
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+class BlockCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        bus_ = std::make_shared<FakeMemoryBus>();
+
+        //NOLINTBEGIN(*-magic-numbers)
+        bus_->poke16(0x100, NOP_OPCODE);
+        bus_->poke16(0x102, MOVEQ_OPCODE);
+        bus_->poke16(0x104, NOP_OPCODE);
+        bus_->poke16(0x106, BRA_OPCODE);
+        bus_->poke16(0x108, NOP_OPCODE);
+        //NOLINTEND(*-magic-numbers)
+
+        decoder_ = std::make_unique<m68k::InstructionDecoder>(bus_);
+        blockCache_ = std::make_unique<m68k::BlockCache>(bus_, *decoder_);
+    }
+
+    void TearDown() override
+    {
+        blockCache_.reset();
+        decoder_.reset();
+    }
+
+    std::shared_ptr<FakeMemoryBus> bus_;
+    std::unique_ptr<m68k::InstructionDecoder> decoder_;
+    std::unique_ptr<m68k::BlockCache> blockCache_;
+};
+
+TEST_F(BlockCacheTests, blockEndsAfterBranch)
+{
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+
+    auto blockResult = blockCache_->fetch(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+
+    const auto& block = blockResult->get();
+    EXPECT_EQ(block.startPc, 0x100);
+    EXPECT_EQ(block.endPc, 0x108);
+    ASSERT_EQ(block.instructions.size(), 4);
+    EXPECT_EQ(block.instructions[1].type, m68k::InstructionType::MOVEQ);
+    EXPECT_EQ(block.instructions[3].type, m68k::InstructionType::BRA);
+    EXPECT_EQ(blockCache_->size(), 1);
+
+    /// a block starting mid-way is a separate entry
+    blockResult = blockCache_->fetch(0x104); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+    EXPECT_EQ(blockResult->get().instructions.size(), 2);
+    EXPECT_EQ(blockCache_->size(), 2);
+
+    EXPECT_EQ(&blockCache_->fetch(0x100)->get(), &block); //NOLINT(*-magic-numbers)
+}
+
+TEST_F(BlockCacheTests, blockStopsBeforeUndecodableWord)
+{
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+    bus_->poke16(0x104, LINE_F_OPCODE); //NOLINT(*-magic-numbers)
+
+    auto blockResult = blockCache_->fetch(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+    EXPECT_EQ(blockResult->get().instructions.size(), 2);
+
+    EXPECT_FALSE(blockCache_->fetch(0x104)); //NOLINT(*-magic-numbers)
+}
+
+TEST_F(BlockCacheTests, writeToRamCodePageInvalidatesBlock)
+{
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::WRITABLE);
+
+    auto blockResult = blockCache_->fetch(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+    const auto& block = blockResult->get();
+
+    ASSERT_TRUE(bus_->write16(0x104, MOVEQ_OPCODE)); //NOLINT(*-magic-numbers)
+
+    /// still readable until the next fetch, but marked invalid
+    EXPECT_FALSE(block.valid);
+    EXPECT_EQ(blockCache_->size(), 0);
+
+    blockResult = blockCache_->fetch(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+    EXPECT_TRUE(blockResult->get().valid);
+    EXPECT_EQ(blockResult->get().instructions[2].type, m68k::InstructionType::MOVEQ);
+}
+
+TEST_F(BlockCacheTests, uncacheableCodeRunsOneInstructionPerBlock)
+{
+    auto blockResult = blockCache_->fetch(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(blockResult);
+    EXPECT_EQ(blockResult->get().instructions.size(), 1);
+    EXPECT_EQ(blockCache_->size(), 0);
+}
+
+TEST_F(BlockCacheTests, idleLoopsAreClassified)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+    /// 0x200: TST.W $2000.w / BEQ.S 0x200
+    bus_->poke16(0x200, 0x4A78);
+    bus_->poke16(0x202, 0x2000);
+    bus_->poke16(0x204, 0x67FA);
+    /// 0x300: DBF D0,0x300
+    bus_->poke16(0x300, 0x51C8);
+    bus_->poke16(0x302, 0xFFFE);
+    /// 0x400: LEA (A0),A1 / BRA.S 0x400
+    bus_->poke16(0x400, 0x43D0);
+    bus_->poke16(0x402, 0x60FC);
+    /// 0x500: BTST #0,$2100(PC) / BEQ.S 0x500, the displacement follows the bit number
+    bus_->poke16(0x500, 0x083A);
+    bus_->poke16(0x502, 0x0000);
+    bus_->poke16(0x504, 0x1BFC);
+    bus_->poke16(0x506, 0x67F8);
+
+    EXPECT_EQ(blockCache_->fetch(0x200)->get().idleLoop, m68k::IdleLoopKind::POLLING);
+    EXPECT_EQ(blockCache_->fetch(0x300)->get().idleLoop, m68k::IdleLoopKind::DBCC_DELAY);
+    EXPECT_EQ(blockCache_->fetch(0x500)->get().idleLoop, m68k::IdleLoopKind::POLLING);
+    /// only reads, compares and tests make up a polling loop
+    EXPECT_EQ(blockCache_->fetch(0x400)->get().idleLoop, m68k::IdleLoopKind::NONE);
+    /// branches elsewhere
+    EXPECT_EQ(blockCache_->fetch(0x100)->get().idleLoop, m68k::IdleLoopKind::NONE);
+
+    /// polling a device register may be what changes it
+    bus_->markReadSideEffects(0x2000);
+    bus_->markReadSideEffects(0x2100);
+    blockCache_->clear();
+    EXPECT_EQ(blockCache_->fetch(0x200)->get().idleLoop, m68k::IdleLoopKind::NONE);
+    EXPECT_EQ(blockCache_->fetch(0x500)->get().idleLoop, m68k::IdleLoopKind::NONE);
+    //NOLINTEND(*-magic-numbers)
+}
+
+TEST_F(BlockCacheTests, hotBlocksAreTranslated)
+{
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+
+    for (uint32_t fetch = 1; fetch < m68k::BasicBlock::HOT_FETCHES; ++fetch) {
+        EXPECT_TRUE(blockCache_->fetch(0x100)->get().handlers.empty()); //NOLINT(*-magic-numbers)
+    }
+
+    const auto& block = blockCache_->fetch(0x100)->get(); //NOLINT(*-magic-numbers)
+    ASSERT_EQ(block.handlers.size(), block.instructions.size());
+    for (size_t index = 0; index < block.instructions.size(); ++index) {
+        EXPECT_EQ(block.handlers[index], m68k::executors_::resolveExecutor(block.instructions[index]));
+    }
+
+    /// uncacheable blocks are rebuilt on every fetch and never get hot
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::UNCACHEABLE);
+    for (uint32_t fetch = 0; fetch < m68k::BasicBlock::HOT_FETCHES; ++fetch) {
+        EXPECT_TRUE(blockCache_->fetch(0x108)->get().handlers.empty()); //NOLINT(*-magic-numbers)
+    }
+}
+
+#if defined(M68K_X86_64_JIT)
+TEST_F(BlockCacheTests, registerOnlyRunsAreCompiledToNativeSegments)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+    bus_->poke16(0x300, 0x7080);    ///< MOVEQ #-128,D0
+    bus_->poke16(0x302, 0x2200);    ///< MOVE.L D0,D1
+    bus_->poke16(0x304, 0x343C);    ///< MOVE.W #$0000,D2
+    bus_->poke16(0x306, 0x0000);
+    bus_->poke16(0x308, 0x2410);    ///< MOVE.L (A0),D2
+    bus_->poke16(0x30A, 0x7602);    ///< MOVEQ #2,D3
+    bus_->poke16(0x30C, 0x60F2);    ///< BRA.S 0x300
+
+    for (uint32_t fetch = 1; fetch < m68k::BasicBlock::HOT_FETCHES; ++fetch) {
+        EXPECT_TRUE(blockCache_->fetch(0x300)->get().nativeSegments.empty());
+    }
+
+    const auto& block = blockCache_->fetch(0x300)->get();
+    ASSERT_EQ(block.nativeSegments.size(), block.instructions.size());
+    const auto& segment = block.nativeSegments[0];
+    ASSERT_NE(segment.entry, nullptr);
+    EXPECT_EQ(segment.instructionsCount, 3);
+    EXPECT_EQ(segment.lengthBytes, 8);
+    EXPECT_TRUE(segment.setsFlags);
+    EXPECT_EQ(segment.cycles, 16);
+    EXPECT_EQ(segment.cyclesBeforeLast, 8);
+    /// MOVEQ alone before the branch is not worth a segment
+    for (size_t index = 1; index < block.nativeSegments.size(); ++index) {
+        EXPECT_EQ(block.nativeSegments[index].entry, nullptr) << index;
+    }
+
+    std::array<uint32_t, 8> dataRegisters{};
+    dataRegisters[2] = 0x12345678;
+    dataRegisters[7] = 0x77;
+    /// Z from the word written last
+    EXPECT_EQ(segment.entry(dataRegisters.data()), m68k_::StatusRegister::ZERO_BIT);
+    EXPECT_EQ(dataRegisters[0], 0xFFFFFF80);
+    EXPECT_EQ(dataRegisters[1], 0xFFFFFF80);
+    EXPECT_EQ(dataRegisters[2], 0x12340000);
+    EXPECT_EQ(dataRegisters[7], 0x77);
+    //NOLINTEND(*-magic-numbers)
+}
+#endif
+
+TEST_F(BlockCacheTests, successorsAreLinkedAndUnlinkedOnWrites)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::WRITABLE);
+    /// 0x200: BRA.W 0x1200, 0x1200: DBF D0,0x200, one code page each
+    bus_->poke16(0x200, 0x6000);
+    bus_->poke16(0x202, 0x0FFE);
+    bus_->poke16(0x1200, 0x51C8);
+    bus_->poke16(0x1202, 0xEFFE);
+
+    const auto& branch = blockCache_->fetch(0x200)->get();
+    const auto& loop = blockCache_->fetch(0x1200)->get();
+    ASSERT_EQ(branch.successorsCount, 1);
+    EXPECT_EQ(branch.successors[0].pc, 0x1200);
+    ASSERT_EQ(loop.successorsCount, 2);
+    EXPECT_EQ(loop.successors[0].pc, 0x200);
+    EXPECT_EQ(loop.successors[1].pc, 0x1204);
+
+    /// linked the first time execution goes that way
+    EXPECT_EQ(branch.successors[0].block, &loop);
+    EXPECT_EQ(loop.successors[0].block, nullptr);
+    EXPECT_EQ(&blockCache_->fetch(0x200)->get(), &branch);
+    EXPECT_EQ(loop.successors[0].block, &branch);
+    EXPECT_EQ(loop.successors[1].block, nullptr);
+    EXPECT_EQ(&blockCache_->fetch(0x1200)->get(), &loop);
+
+    /// dropping the loop block unlinks it from the branch block, which stays cached
+    ASSERT_TRUE(bus_->write16(0x1300, NOP_OPCODE));
+    EXPECT_FALSE(loop.valid);
+    EXPECT_TRUE(branch.valid);
+    EXPECT_EQ(branch.successors[0].block, nullptr);
+    EXPECT_TRUE(branch.predecessors.empty());
+
+    EXPECT_EQ(&blockCache_->fetch(0x200)->get(), &branch);
+    const auto& rebuiltLoop = blockCache_->fetch(0x1200)->get();
+    EXPECT_EQ(branch.successors[0].block, &rebuiltLoop);
+    EXPECT_EQ(rebuiltLoop.predecessors.size(), 1);
+    //NOLINTEND(*-magic-numbers)
+}
+
+TEST_F(BlockCacheTests, followEntersLinkedSuccessorsOnly)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    bus_->setCodeMemoryType(DataExchange::CodeMemoryType::WRITABLE);
+    /// 0x200: BRA.W 0x1200, 0x1200: DBF D0,0x200
+    bus_->poke16(0x200, 0x6000);
+    bus_->poke16(0x202, 0x0FFE);
+    bus_->poke16(0x1200, 0x51C8);
+    bus_->poke16(0x1202, 0xEFFE);
+
+    const auto& branch = blockCache_->fetch(0x200)->get();
+    /// not linked before the first fetch goes that way
+    EXPECT_EQ(blockCache_->follow(branch, 0x1200), nullptr);
+    const auto& loop = blockCache_->fetch(0x1200)->get();
+    const uint32_t loopFetches = loop.fetches;
+
+    EXPECT_EQ(blockCache_->follow(branch, 0x1200), &loop);
+    EXPECT_EQ(loop.fetches, loopFetches + 1);
+    /// not a successor of the branch block
+    EXPECT_EQ(blockCache_->follow(branch, 0x1204), nullptr);
+
+    ASSERT_TRUE(bus_->write16(0x1300, NOP_OPCODE));
+    EXPECT_EQ(blockCache_->follow(branch, 0x1200), nullptr);
+    //NOLINTEND(*-magic-numbers)
+}
+
+} // namespace
@@ -97,4 +97,31 @@ TEST(BusHelpersTest, ReadUint8OddAddress)
     EXPECT_TRUE(result.has_value());
     EXPECT_EQ(result->data, 0x34); // младший байт
     EXPECT_EQ(result->waitCycles, 4);
+}
+
+TEST(BusHelpersTest, WriteUint32SplitsIntoWordsByDefault)
+{
+    m68k::BusHelpersTest::MockBus bus;
+
+    testing::InSequence sequence;
+    EXPECT_CALL(bus, write16(0x0400, 0x1234)).WillOnce(testing::Return(std::expected<void, DataExchange::MemoryAccessError>{}));
+    EXPECT_CALL(bus, write16(0x0402, 0x5678)).WillOnce(testing::Return(std::expected<void, DataExchange::MemoryAccessError>{}));
+
+    const auto writeResult = m68k::busHelper::write<uint32_t>(bus, 0x0400, 0x12345678);
+
+    EXPECT_TRUE(writeResult.has_value());
+}
+
+TEST(BusHelpersTest, WriteUint8KeepsNeighbourByte)
+{
+    m68k::BusHelpersTest::MockBus bus;
+
+    DataExchange::MemoryAccessResult readResult{.data=0x1234, .waitCycles=4};
+
+    EXPECT_CALL(bus, read16(0x0501)).WillOnce(testing::Return(readResult));
+    EXPECT_CALL(bus, write16(0x0501, 0x12AB)).WillOnce(testing::Return(std::expected<void, DataExchange::MemoryAccessError>{}));
+
+    const auto writeResult = m68k::busHelper::write<uint8_t>(bus, 0x0501, 0xAB);
+
+    EXPECT_TRUE(writeResult.has_value());
 }
\ No newline at end of file
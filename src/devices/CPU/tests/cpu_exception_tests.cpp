@@ -0,0 +1,197 @@
+#include <cpu/cpu.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+//NOLINTBEGIN(*-magic-numbers)
+class CPUExceptionTests : public ::testing::Test {
+protected:
+    static constexpr uint32_t SUPERVISOR_STACK = 0x8000;
+
+    void SetUp() override
+    {
+        bus_ = std::make_shared<FakeMemoryBus>();
+        pokeVector(2, 0x1400);  ///< bus error
+        pokeVector(3, 0x1300);  ///< address error
+        pokeVector(4, 0x1000);  ///< illegal instruction
+        pokeVector(10, 0x1100); ///< line A
+        pokeVector(11, 0x1200); ///< line F
+        pokeVector(35, 0x1500); ///< TRAP #3
+        pokeVector(30, 0x1600); ///< level 6 autovector
+        pokeVector(31, 0x1700); ///< level 7 autovector
+
+        /// BRA.S to itself, at the program start and in the interrupt handlers
+        for(const uint32_t address : {0x100U, 0x1600U, 0x1700U}) {
+            bus_->poke16(address, 0x60FE);
+        }
+
+        cpu_ = std::make_unique<m68k::CPU>(bus_);
+        auto& regs = cpu_->registers();
+        regs.setSupervisorState(false);
+        regs.USP() = 0x4000;
+        regs.SSP() = SUPERVISOR_STACK;
+        regs.PC() = 0x100;
+    }
+
+    void pokeVector(uint32_t vector, uint32_t handler)
+    {
+        bus_->poke16(vector * 4, static_cast<uint16_t>(handler >> 16U));
+        bus_->poke16(vector * 4 + 2, static_cast<uint16_t>(handler));
+    }
+
+    [[nodiscard]] uint16_t peek16(uint32_t address) const
+    {
+        return bus_->read16(address)->data;
+    }
+
+    [[nodiscard]] uint32_t peek32(uint32_t address) const
+    {
+        return (static_cast<uint32_t>(peek16(address)) << 16U) | peek16(address + 2);
+    }
+
+    std::shared_ptr<FakeMemoryBus> bus_;
+    std::unique_ptr<m68k::CPU> cpu_;
+};
+
+TEST_F(CPUExceptionTests, illegalInstructionStacksItsOwnAddress)
+{
+    bus_->poke16(0x100, 0x4AFC);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    const auto& regs = cpu_->registers();
+    EXPECT_EQ(regs.PC(), 0x1000);
+    EXPECT_TRUE(regs.SR().supervisorOrUserState());
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 6);
+    /// SR as it was in user mode, then the PC of the illegal instruction
+    EXPECT_EQ(peek16(SUPERVISOR_STACK - 6), 0x0000);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 4), 0x100);
+    EXPECT_EQ(regs.USP(), 0x4000);
+}
+
+TEST_F(CPUExceptionTests, lineAAndLineFOpcodesUseTheirVectors)
+{
+    bus_->poke16(0x100, 0xA123);
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().PC(), 0x1100);
+
+    bus_->poke16(0x1100, 0xF000);
+    ASSERT_TRUE(cpu_->run(1));
+    EXPECT_EQ(cpu_->registers().PC(), 0x1200);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 10), 0x1100);
+}
+
+TEST_F(CPUExceptionTests, trapContinuesAfterTheInstruction)
+{
+    /// TRAP #3
+    bus_->poke16(0x100, 0x4E43);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().PC(), 0x1500);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 4), 0x102);
+}
+
+TEST_F(CPUExceptionTests, oddPcRaisesAddressError)
+{
+    cpu_->registers().PC() = 0x101;
+
+    ASSERT_TRUE(cpu_->run(1));
+    const auto& regs = cpu_->registers();
+    EXPECT_EQ(regs.PC(), 0x1300);
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 14);
+    /// read, instruction fetch, user program space
+    EXPECT_EQ(peek16(SUPERVISOR_STACK - 14), 0x12);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 12), 0x101);
+}
+
+TEST_F(CPUExceptionTests, unmappedFetchRaisesBusError)
+{
+    cpu_->registers().PC() = 0x20000;
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().PC(), 0x1400);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 12), 0x20000);
+}
+
+TEST_F(CPUExceptionTests, faultWhileStackingHaltsUntilReset)
+{
+    bus_->poke16(0x100, 0x4AFC);
+    cpu_->registers().SSP() = 0x20000;
+
+    const auto result = cpu_->run(100);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::CPUError::HALTED);
+    EXPECT_EQ(cpu_->executeNextInstruction().error(), m68k::CPUError::HALTED);
+
+    EXPECT_TRUE(cpu_->reset());
+    EXPECT_TRUE(cpu_->run(0));
+}
+
+TEST_F(CPUExceptionTests, missingExecutorIsAHostError)
+{
+    /// RTS has no executor yet
+    bus_->poke16(0x100, 0x4E75);
+
+    const auto result = cpu_->executeNextInstruction();
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::CPUError::UNIMPLEMENTED_INSTRUCTION);
+}
+TEST_F(CPUExceptionTests, interruptAboveMaskIsTakenBetweenBatches)
+{
+    auto& regs = cpu_->registers();
+    regs.SR().setInterruptMask(3);
+    cpu_->interruptController().raiseIPL(6);
+
+    ASSERT_TRUE(cpu_->run(20));
+    EXPECT_EQ(regs.PC(), 0x1600);
+    EXPECT_EQ(regs.SR().interruptMask(), 6);
+    EXPECT_TRUE(regs.SR().supervisorOrUserState());
+    EXPECT_EQ(peek16(SUPERVISOR_STACK - 6), 0x0300);
+    EXPECT_EQ(peek32(SUPERVISOR_STACK - 4), 0x100);
+
+    /// still asserted, but no longer above the mask
+    ASSERT_TRUE(cpu_->run(20));
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 6);
+}
+
+TEST_F(CPUExceptionTests, maskedInterruptWaits)
+{
+    auto& regs = cpu_->registers();
+    regs.SR().setInterruptMask(6);
+    cpu_->interruptController().raiseIPL(4);
+    cpu_->interruptController().raiseIPL(6);
+
+    ASSERT_TRUE(cpu_->run(40));
+    EXPECT_EQ(regs.PC(), 0x100);
+
+    cpu_->interruptController().lowerIPL(6);
+    cpu_->interruptController().lowerIPL(4);
+    EXPECT_EQ(cpu_->interruptController().pendingLevel(), 0);
+}
+
+TEST_F(CPUExceptionTests, levelSevenIsTakenOncePerEdge)
+{
+    auto& regs = cpu_->registers();
+    regs.SR().setInterruptMask(7);
+    auto& interrupts = cpu_->interruptController();
+
+    interrupts.raiseIPL(7);
+    ASSERT_TRUE(cpu_->run(20));
+    EXPECT_EQ(regs.PC(), 0x1700);
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 6);
+
+    ASSERT_TRUE(cpu_->run(20));
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 6);
+
+    interrupts.lowerIPL(7);
+    interrupts.raiseIPL(7);
+    ASSERT_TRUE(cpu_->run(20));
+    EXPECT_EQ(regs.SSP(), SUPERVISOR_STACK - 12);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
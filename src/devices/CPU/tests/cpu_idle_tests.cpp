@@ -0,0 +1,116 @@
+#include <cpu/cpu.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+//NOLINTBEGIN(*-magic-numbers)
+class CPUIdleTests : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        bus_ = std::make_shared<FakeMemoryBus>();
+        bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+        pokeVector(8, 0x1000);  ///< privilege violation
+        pokeVector(30, 0x1600); ///< level 6 autovector
+        bus_->poke16(0x1000, 0x60FE);
+        bus_->poke16(0x1600, 0x60FE);
+
+        cpu_ = std::make_unique<m68k::CPU>(bus_);
+        auto& regs = cpu_->registers();
+        regs.setSupervisorState(true);
+        regs.SSP() = 0x8000;
+        regs.PC() = 0x100;
+    }
+
+    void pokeVector(uint32_t vector, uint32_t handler)
+    {
+        bus_->poke16(vector * 4, static_cast<uint16_t>(handler >> 16U));
+        bus_->poke16(vector * 4 + 2, static_cast<uint16_t>(handler));
+    }
+
+    std::shared_ptr<FakeMemoryBus> bus_;
+    std::unique_ptr<m68k::CPU> cpu_;
+};
+
+TEST_F(CPUIdleTests, stopWaitsForAnInterrupt)
+{
+    /// STOP #$2000
+    bus_->poke16(0x100, 0x4E72);
+    bus_->poke16(0x102, 0x2000);
+
+    EXPECT_EQ(cpu_->run(1000).value(), 1000);
+    EXPECT_EQ(cpu_->registers().PC(), 0x104);
+    EXPECT_EQ(cpu_->registers().SR().interruptMask(), 0);
+    EXPECT_EQ(cpu_->fastForwardedCycles(), 996);
+
+    /// single stepping does not leave STOP either
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().PC(), 0x104);
+
+    cpu_->interruptController().raiseIPL(6);
+    ASSERT_TRUE(cpu_->run(100));
+    EXPECT_EQ(cpu_->registers().PC(), 0x1600);
+    EXPECT_EQ(cpu_->registers().SR().interruptMask(), 6);
+}
+
+TEST_F(CPUIdleTests, stopInUserModeIsPrivileged)
+{
+    cpu_->registers().setSupervisorState(false);
+    bus_->poke16(0x100, 0x4E72);
+    bus_->poke16(0x102, 0x2700);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().PC(), 0x1000);
+    EXPECT_TRUE(cpu_->registers().SR().supervisorOrUserState());
+}
+
+TEST_F(CPUIdleTests, delayLoopIsFastForwarded)
+{
+    /// DBF D0,0x100
+    bus_->poke16(0x100, 0x51C8);
+    bus_->poke16(0x102, 0xFFFE);
+    cpu_->registers().D(0) = 0x12340100;
+
+    /// one taken DBF of 10 cycles is executed, 99 more are skipped
+    EXPECT_EQ(cpu_->run(1000).value(), 1000);
+    EXPECT_EQ(cpu_->registers().D(0), 0x12340100 - 100);
+    EXPECT_EQ(cpu_->registers().PC(), 0x100);
+    EXPECT_EQ(cpu_->fastForwardedCycles(), 990);
+
+    /// the counter is never skipped past its last taken iteration
+    EXPECT_EQ(cpu_->run(1574).value(), 1574);
+    EXPECT_EQ(cpu_->registers().PC(), 0x104);
+    EXPECT_EQ(cpu_->registers().D(0), 0x1234FFFF);
+    EXPECT_EQ(cpu_->fastForwardedCycles(), 990 + 1550);
+}
+
+TEST_F(CPUIdleTests, pollingLoopIsFastForwardedOnceItSettles)
+{
+    /// MOVEQ #0,D0 / BEQ.S 0x100
+    bus_->poke16(0x100, 0x7000);
+    bus_->poke16(0x102, 0x67FC);
+
+    /// the first iteration sets Z, the second changes nothing and the rest is skipped
+    EXPECT_EQ(cpu_->run(1008).value(), 1008);
+    EXPECT_EQ(cpu_->registers().PC(), 0x100);
+    EXPECT_EQ(cpu_->fastForwardedCycles(), 980);
+}
+
+TEST_F(CPUIdleTests, executeBlockDoesNotFastForward)
+{
+    bus_->poke16(0x100, 0x51C8);
+    bus_->poke16(0x102, 0xFFFE);
+    cpu_->registers().D(0) = 5;
+
+    ASSERT_TRUE(cpu_->executeBlock());
+    EXPECT_EQ(cpu_->registers().D(0), 4);
+    EXPECT_EQ(cpu_->fastForwardedCycles(), 0);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
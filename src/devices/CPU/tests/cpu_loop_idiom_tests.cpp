@@ -0,0 +1,129 @@
+#include <cpu/cpu.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+//NOLINTBEGIN(*-magic-numbers)
+constexpr uint32_t SOURCE = 0x2000;
+constexpr uint32_t DESTINATION = 0x3000;
+
+/// One CPU running a loop at 0x100 followed by STOP #$2700
+class LoopRun {
+public:
+    LoopRun(uint16_t moveOpcode, uint32_t counter, bool bulkAllowed)
+    {
+        bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+        bus_->poke16(0x100, moveOpcode);
+        bus_->poke16(0x102, 0x51C8);    ///< DBF D0,0x100
+        bus_->poke16(0x104, 0xFFFC);
+        bus_->poke16(0x106, 0x4E72);
+        bus_->poke16(0x108, 0x2700);
+        for (uint32_t offset = 0; offset < 0x100; offset += 2) {
+            bus_->poke16(SOURCE + offset, static_cast<uint16_t>(0x8000 + offset));
+        }
+        if (!bulkAllowed) {
+            /// device-like addresses throughout both ranges: every loop entry retries the bulk path
+            for (uint32_t offset = 0; offset < 0x100; offset += 4) {
+                bus_->markReadSideEffects(SOURCE + offset);
+                bus_->markReadSideEffects(DESTINATION + offset);
+            }
+        }
+
+        auto& regs = cpu_.registers();
+        regs.setSupervisorState(true);
+        regs.SSP() = 0x8000;
+        regs.PC() = 0x100;
+        regs.A(0) = SOURCE;
+        regs.A(1) = DESTINATION;
+        regs.D(0) = counter;
+        regs.D(1) = 0x1234BEEF;
+    }
+
+    std::shared_ptr<FakeMemoryBus> bus_ = std::make_shared<FakeMemoryBus>();
+    m68k::CPU cpu_{bus_};
+};
+
+void expectSameResult(LoopRun& bulk, LoopRun& executed)
+{
+    EXPECT_EQ(bulk.cpu_.registers(), executed.cpu_.registers());
+    EXPECT_EQ(bulk.cpu_.steps(), executed.cpu_.steps());
+    EXPECT_EQ(bulk.cpu_.fastForwardedCycles(), executed.cpu_.fastForwardedCycles());
+    for (uint32_t offset = 0; offset < 0x100; offset += 2) {
+        EXPECT_EQ(bulk.bus_->read16(DESTINATION + offset)->data, executed.bus_->read16(DESTINATION + offset)->data) << offset;
+    }
+}
+
+TEST(CPULoopIdiomTests, copyLoopRunsAsOneCopy)
+{
+    /// MOVE.L (A0)+,(A1)+, 16 times
+    LoopRun bulk(0x22D8, 0x1234000F, true);
+    LoopRun executed(0x22D8, 0x1234000F, false);
+
+    /// 30 cycles per iteration: the budget stops both after 5
+    EXPECT_EQ(bulk.cpu_.run(150).value(), 150);
+    EXPECT_EQ(executed.cpu_.run(150).value(), 150);
+    EXPECT_EQ(bulk.cpu_.registers().D(0), 0x1234000A);
+    EXPECT_EQ(bulk.cpu_.registers().A(1), DESTINATION + 20);
+    EXPECT_EQ(bulk.bus_->bulkOperationsCount(), 1);
+    EXPECT_EQ(executed.bus_->bulkOperationsCount(), 0);
+    /// N from the last long moved
+    EXPECT_TRUE(bulk.cpu_.registers().SR().negative());
+    expectSameResult(bulk, executed);
+
+    ASSERT_TRUE(bulk.cpu_.run(10000));
+    ASSERT_TRUE(executed.cpu_.run(10000));
+    EXPECT_EQ(bulk.bus_->bulkOperationsCount(), 2);
+    EXPECT_EQ(executed.bus_->bulkOperationsCount(), 0);
+    EXPECT_EQ(bulk.cpu_.registers().D(0), 0x1234FFFF);
+    EXPECT_EQ(bulk.cpu_.registers().A(0), SOURCE + 64);
+    EXPECT_EQ(bulk.cpu_.registers().PC(), 0x10A);
+    EXPECT_EQ(bulk.bus_->read32(DESTINATION + 60)->data, 0x803C803E);
+    expectSameResult(bulk, executed);
+}
+
+TEST(CPULoopIdiomTests, fillLoopRunsAsOneFill)
+{
+    /// MOVE.W D1,(A1)+, 100 times
+    LoopRun bulk(0x32C1, 99, true);
+    LoopRun executed(0x32C1, 99, false);
+
+    ASSERT_TRUE(bulk.cpu_.run(10000));
+    ASSERT_TRUE(executed.cpu_.run(10000));
+    EXPECT_EQ(bulk.bus_->bulkOperationsCount(), 1);
+    EXPECT_EQ(executed.bus_->bulkOperationsCount(), 0);
+    EXPECT_EQ(bulk.bus_->read16(DESTINATION + 198)->data, 0xBEEF);
+    EXPECT_EQ(bulk.bus_->read16(DESTINATION + 200)->data, 0);
+    EXPECT_EQ(bulk.cpu_.registers().A(1), DESTINATION + 200);
+    expectSameResult(bulk, executed);
+}
+
+TEST(CPULoopIdiomTests, loopsAreExecutedWhereBulkWouldDiffer)
+{
+    /// odd destination: the first MOVE.W takes an address error
+    LoopRun odd(0x32C1, 9, true);
+    odd.cpu_.registers().A(1) = DESTINATION + 1;
+    (void)odd.cpu_.run(100);
+    EXPECT_EQ(odd.bus_->bulkOperationsCount(), 0);
+    EXPECT_EQ(odd.bus_->read16(DESTINATION)->data, 0);
+
+    /// the counter is the filled value
+    LoopRun counter(0x32C0, 9, true);
+    ASSERT_TRUE(counter.cpu_.run(10000));
+    EXPECT_EQ(counter.bus_->bulkOperationsCount(), 0);
+    EXPECT_EQ(counter.bus_->read16(DESTINATION)->data, 9);
+    EXPECT_EQ(counter.bus_->read16(DESTINATION + 2)->data, 8);
+
+    /// executeBlock() runs one iteration at a time
+    LoopRun stepped(0x22D8, 9, true);
+    ASSERT_TRUE(stepped.cpu_.executeBlock());
+    EXPECT_EQ(stepped.cpu_.registers().D(0), 8);
+    EXPECT_EQ(stepped.bus_->bulkOperationsCount(), 0);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
@@ -0,0 +1,128 @@
+#include <cpu/cpu.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+//NOLINTBEGIN(*-magic-numbers)
+class CPURunTests : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        bus_ = std::make_shared<FakeMemoryBus>();
+        bus_->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+
+        /// loop: MOVEQ #1,D0 / NOP / BRA.S loop
+        bus_->poke16(0x100, 0x7001);
+        bus_->poke16(0x102, 0x4E71);
+        bus_->poke16(0x104, 0x60FA);
+
+        cpu_ = std::make_unique<m68k::CPU>(bus_);
+        cpu_->registers().PC() = 0x100;
+    }
+
+    std::shared_ptr<FakeMemoryBus> bus_;
+    std::unique_ptr<m68k::CPU> cpu_;
+};
+
+TEST_F(CPURunTests, runStopsWhenBudgetIsConsumed)
+{
+    /// MOVEQ 4, NOP 4, BRA 10: two loops and a MOVEQ
+    EXPECT_EQ(cpu_->run(40).value(), 40);
+    EXPECT_EQ(cpu_->registers().PC(), 0x102);
+    EXPECT_EQ(cpu_->registers().D(0), 1);
+
+    /// the last instruction is always completed
+    EXPECT_EQ(cpu_->run(6).value(), 14);
+    EXPECT_EQ(cpu_->registers().PC(), 0x100);
+}
+
+TEST_F(CPURunTests, branchOutcomeChangesInstructionTime)
+{
+    /// MOVEQ #2,D1 / loop: DBF D1,loop / NOP
+    bus_->poke16(0x200, 0x7202);
+    bus_->poke16(0x202, 0x51C9);
+    bus_->poke16(0x204, 0xFFFE);
+    bus_->poke16(0x206, 0x4E71);
+    cpu_->registers().PC() = 0x200;
+
+    /// MOVEQ 4, two taken DBF 10 each, expired DBF 14
+    EXPECT_EQ(cpu_->run(38).value(), 38);
+    EXPECT_EQ(cpu_->registers().PC(), 0x206);
+}
+
+TEST_F(CPURunTests, decodedMovesExecuteEndToEnd)
+{
+    bus_->poke16(0x300, 0x223C);    ///< MOVE.L #$12345678,D1
+    bus_->poke16(0x302, 0x1234);
+    bus_->poke16(0x304, 0x5678);
+    bus_->poke16(0x306, 0x30C1);    ///< MOVE.W D1,(A0)+
+    bus_->poke16(0x308, 0x3360);    ///< MOVE.W -(A0),(16,A1)
+    bus_->poke16(0x30A, 0x0010);
+    bus_->poke16(0x30C, 0x1403);    ///< MOVE.B D3,D2
+
+    auto& regs = cpu_->registers();
+    regs.PC() = 0x300;
+    regs.A(0) = 0x2000;
+    regs.A(1) = 0x3000;
+    regs.D(2) = 0xFFFFFF00;
+    regs.D(3) = 0x12345680;
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().D(1), 0x12345678);
+    EXPECT_EQ(cpu_->registers().PC(), 0x306);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(bus_->read16(0x2000)->data, 0x5678);
+    EXPECT_EQ(cpu_->registers().A(0), 0x2002);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().A(0), 0x2000);
+    EXPECT_EQ(bus_->read16(0x3010)->data, 0x5678);
+    EXPECT_EQ(cpu_->registers().PC(), 0x30C);
+
+    ASSERT_TRUE(cpu_->executeNextInstruction());
+    EXPECT_EQ(cpu_->registers().D(2), 0xFFFFFF80);
+    EXPECT_TRUE(cpu_->registers().SR().negative());
+    EXPECT_EQ(cpu_->registers().PC(), 0x30E);
+    EXPECT_EQ(cpu_->steps(), 4);
+}
+
+TEST_F(CPURunTests, chainedBlocksMatchSteppedExecution)
+{
+    /// 0x400: two block loop: MOVEQ #5,D1 / BRA.W 0x1400, 0x1400: DBF D0,0x400
+    bus_->poke16(0x400, 0x7205);
+    bus_->poke16(0x402, 0x6000);
+    bus_->poke16(0x404, 0x0FFC);
+    bus_->poke16(0x1400, 0x51C8);
+    bus_->poke16(0x1402, 0xEFFE);
+    bus_->poke16(0x1404, 0x4E71);
+
+    m68k::CPU stepped(bus_);
+    for(auto* cpu : {cpu_.get(), &stepped}) {
+        cpu->registers().PC() = 0x400;
+        cpu->registers().D(0) = 40;
+    }
+
+    /// MOVEQ 4, BRA 10, taken DBF 10: several chained passes, then the budget ends mid-loop
+    const int64_t usedCycles = cpu_->run(500).value();
+    EXPECT_EQ(usedCycles, 504);
+    while(stepped.steps() < cpu_->steps()) {
+        ASSERT_TRUE(stepped.executeNextInstruction());
+    }
+    EXPECT_EQ(cpu_->registers(), stepped.registers());
+    EXPECT_EQ(cpu_->registers().D(0), 40 - 21);
+}
+
+TEST_F(CPURunTests, emptyBudgetExecutesNothing)
+{
+    EXPECT_EQ(cpu_->run(0).value(), 0);
+    EXPECT_EQ(cpu_->registers().PC(), 0x100);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
@@ -0,0 +1,169 @@
+#include <cpu/internal/instruction_executor/executor_table.h>
+#include <cpu/internal/instruction_executor/executors/MOVE_executor.h>
+#include <cpu/internal/instruction_executor/executors/NOP_executor.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+class ExecutorsTests : public ::testing::Test {
+protected:
+    std::expected<void, m68k::ExecuteError> execute(const m68k::Instruction& instruction, uint32_t instructionPc, uint32_t instructionSize)
+    {
+        regs_.PC() = instructionPc + instructionSize;
+        m68k::executors_::ExecutionContext context{.regs = regs_, .bus = bus_, .flags = flags_, .instructionPc = instructionPc};
+        const auto result = m68k::executors_::executeInstruction(context, m68k::packInstruction(instruction, instructionSize));
+        flags_.materialize(regs_.SR());
+        return result;
+    }
+
+    m68k_::Registers regs_{};
+    m68k::executors_::LazyFlags flags_;
+    FakeMemoryBus bus_;
+};
+
+//NOLINTBEGIN(*-magic-numbers)
+TEST_F(ExecutorsTests, MOVEQSignExtendsAndSetsFlags)
+{
+    regs_.SR().setExtend(true);
+    regs_.SR().setCarry(true);
+
+    ASSERT_TRUE(execute(m68k::InstructionData::MOVEQ_InstructionData{.dataRegNumber = 3, .data = -2}, 0x100, 2));
+    EXPECT_EQ(regs_.D(3), 0xFFFFFFFE);
+    EXPECT_TRUE(regs_.SR().negative());
+    EXPECT_FALSE(regs_.SR().zero());
+    EXPECT_FALSE(regs_.SR().carry());
+    EXPECT_TRUE(regs_.SR().extend());
+
+    ASSERT_TRUE(execute(m68k::InstructionData::MOVEQ_InstructionData{.dataRegNumber = 3, .data = 0}, 0x102, 2));
+    EXPECT_EQ(regs_.D(3), 0);
+    EXPECT_TRUE(regs_.SR().zero());
+    EXPECT_EQ(regs_.PC(), 0x104);
+}
+
+TEST_F(ExecutorsTests, BranchesAreRelativeToExtensionWord)
+{
+    ASSERT_TRUE(execute(m68k::InstructionData::BRA_InstructionData{.displacement = static_cast<int32_t>(-4)}, 0x100, 2));
+    EXPECT_EQ(regs_.PC(), 0xFE);
+
+    ASSERT_TRUE(execute(m68k::InstructionData::BRA_InstructionData{.displacement = static_cast<int16_t>(0x20)}, 0x100, 4));
+    EXPECT_EQ(regs_.PC(), 0x122);
+
+    regs_.SR().setZero(false);
+    ASSERT_TRUE(execute(m68k::InstructionData::Bcc_InstructionData{.condition = m68k::Condition::EQUAL, .displacement = static_cast<int32_t>(0x10)}, 0x200, 2));
+    EXPECT_EQ(regs_.PC(), 0x202);
+
+    ASSERT_TRUE(execute(m68k::InstructionData::Bcc_InstructionData{.condition = m68k::Condition::NOT_EQUAL, .displacement = static_cast<int32_t>(0x10)}, 0x200, 2));
+    EXPECT_EQ(regs_.PC(), 0x212);
+}
+
+TEST_F(ExecutorsTests, DBccDecrementsLowWordUntilMinusOne)
+{
+    regs_.D(1) = 0x12340001;
+    const m68k::InstructionData::DBcc_InstructionData dbra{.condition = m68k::Condition::FALSE, .registerNumber = 1, .displacement = -6};
+
+    ASSERT_TRUE(execute(dbra, 0x100, 4));
+    EXPECT_EQ(regs_.D(1), 0x12340000);
+    EXPECT_EQ(regs_.PC(), 0xFC);
+
+    ASSERT_TRUE(execute(dbra, 0x100, 4));
+    EXPECT_EQ(regs_.D(1), 0x1234FFFF);
+    EXPECT_EQ(regs_.PC(), 0x104);
+
+    /// a true condition ends the loop without touching the counter
+    const m68k::InstructionData::DBcc_InstructionData dbt{.condition = m68k::Condition::TRUE, .registerNumber = 1, .displacement = -6};
+    ASSERT_TRUE(execute(dbt, 0x100, 4));
+    EXPECT_EQ(regs_.D(1), 0x1234FFFF);
+    EXPECT_EQ(regs_.PC(), 0x104);
+}
+
+TEST_F(ExecutorsTests, MOVEHandlersFollowSizeAndAddressingModes)
+{
+    using m68k::InstructionData::MOVE_InstructionData;
+
+    /// MOVE.L D1,(A0)+
+    regs_.D(1) = 0x80001234;
+    regs_.A(0) = 0x2000;
+    ASSERT_TRUE(execute(MOVE_InstructionData{.size = m68k::OperationSize::LONG,
+                                             .sourceAddressingModeData = m68k::DataRegisterModeData{.dataRegNum = 1},
+                                             .destinationAddressingModeData = m68k::AddressWithPostincrementModeData{.addressRegNum = 0}}, 0x100, 2));
+    EXPECT_EQ(bus_.read32(0x2000)->data, 0x80001234);
+    EXPECT_EQ(regs_.A(0), 0x2004);
+    EXPECT_TRUE(regs_.SR().negative());
+
+    /// MOVE.W (-2,A0,D2.W),D3 ignores the upper word of D2 and keeps the one of D3
+    regs_.D(2) = 0x12340000;
+    regs_.D(3) = 0xAAAA0000;
+    ASSERT_TRUE(execute(MOVE_InstructionData{.size = m68k::OperationSize::WORD,
+                                             .sourceAddressingModeData = m68k::AddressWithIndexModeData{
+                                                 .addressRegNum = 0,
+                                                 .extensionWord = {.displacement = -2,
+                                                                   .indexSize = m68k::IndexedMode::IndexSize::WORD,
+                                                                   .registerType = m68k::IndexedMode::RegisterType::DATA_REGISTER,
+                                                                   .registerNum = 2}},
+                                             .destinationAddressingModeData = m68k::DataRegisterModeData{.dataRegNum = 3}}, 0x100, 4));
+    EXPECT_EQ(regs_.D(3), 0xAAAA1234);
+    EXPECT_FALSE(regs_.SR().negative());
+
+    /// MOVE.B #0,-(A7) keeps the stack word aligned
+    regs_.A(7) = 0x3000;
+    ASSERT_TRUE(execute(MOVE_InstructionData{.size = m68k::OperationSize::BYTE,
+                                             .sourceAddressingModeData = m68k::ImmediateModeData{.immediateData = static_cast<uint8_t>(0)},
+                                             .destinationAddressingModeData = m68k::AddressWithPredecrementModeData{.addressRegNum = 7}}, 0x100, 4));
+    EXPECT_EQ(regs_.A(7), 0x2FFE);
+    EXPECT_TRUE(regs_.SR().zero());
+}
+
+TEST_F(ExecutorsTests, MOVEToOddAddressIsAWriteAddressError)
+{
+    regs_.A(1) = 0x2001;
+    regs_.PC() = 0x102;
+    m68k::executors_::ExecutionContext context{.regs = regs_, .bus = bus_, .flags = flags_, .instructionPc = 0x100};
+    const auto move = m68k::packInstruction(m68k::InstructionData::MOVE_InstructionData{
+        .size = m68k::OperationSize::WORD,
+        .sourceAddressingModeData = m68k::DataRegisterModeData{.dataRegNum = 0},
+        .destinationAddressingModeData = m68k::AddressModeData{.addressRegNum = 1}}, 2);
+
+    const auto result = m68k::executors_::executeInstruction(context, move);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::ExecuteError::ADDRESS_ERROR);
+    EXPECT_EQ(context.faultAddress, 0x2001);
+    EXPECT_TRUE(context.faultOnWrite);
+}
+
+TEST_F(ExecutorsTests, ResolvedHandlersSkipTheDispatchTables)
+{
+    using m68k::executors_::resolveExecutor;
+
+    const auto nop = m68k::packInstruction(m68k::InstructionData::NOP_InstructionData{}, 2);
+    EXPECT_EQ(resolveExecutor(nop), &m68k::executors_::execute<m68k::InstructionType::NOP>);
+
+    /// MOVE resolves to the handler of its operands, MOVE.W D0,(A1) here
+    regs_.D(0) = 0x5678;
+    regs_.A(1) = 0x2000;
+    regs_.PC() = 0x102;
+    const auto move = m68k::packInstruction(m68k::InstructionData::MOVE_InstructionData{
+        .size = m68k::OperationSize::WORD,
+        .sourceAddressingModeData = m68k::DataRegisterModeData{.dataRegNum = 0},
+        .destinationAddressingModeData = m68k::AddressModeData{.addressRegNum = 1}}, 2);
+    const auto handler = resolveExecutor(move);
+    EXPECT_NE(handler, &m68k::executors_::execute<m68k::InstructionType::MOVE>);
+
+    m68k::executors_::ExecutionContext context{.regs = regs_, .bus = bus_, .flags = flags_, .instructionPc = 0x100};
+    ASSERT_TRUE(handler(context, move));
+    EXPECT_EQ(bus_.read16(0x2000)->data, 0x5678);
+}
+
+TEST_F(ExecutorsTests, UnimplementedInstructionIsReported)
+{
+    const auto result = execute(m68k::InstructionData::RESET_InstructionData{}, 0x100, 2);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::ExecuteError::UNIMPLEMENTED_INSTRUCTION);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
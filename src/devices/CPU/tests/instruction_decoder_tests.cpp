@@ -0,0 +1,211 @@
+#include <array>
+#include <cpu/internal/instruction_decoder/instruction_decoder.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+//NOLINTBEGIN(*-magic-numbers)
+constexpr uint16_t NOP_OPCODE = 0x4E71;
+constexpr uint16_t MOVEQ_OPCODE = 0x7001;
+/// LEA (-8,A0),A1
+constexpr uint16_t LEA_OPCODE = 0x43E8;
+constexpr uint16_t LEA_DISPLACEMENT = 0xFFF8;
+//NOLINTEND(*-magic-numbers)
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+TEST(InstructionDecoderTests, decoderRegistersAsCodeWriteListener)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    {
+        const m68k::InstructionDecoder decoder(bus);
+        EXPECT_EQ(bus->listenersCount(), 1);
+    }
+    EXPECT_EQ(bus->listenersCount(), 0);
+}
+
+TEST(InstructionDecoderTests, readOnlyCodeIsServedFromCache)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    bus->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+    bus->poke16(0x100, NOP_OPCODE); //NOLINT(*-magic-numbers)
+
+    m68k::InstructionDecoder decoder(bus);
+
+    auto result = decoder.decodeCached(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::NOP);
+    EXPECT_FALSE(bus->isWatched(0x100)); //NOLINT(*-magic-numbers)
+
+    /// the cache does not see this store, so the stale NOP is still returned
+    bus->poke16(0x100, MOVEQ_OPCODE); //NOLINT(*-magic-numbers)
+
+    result = decoder.decodeCached(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::NOP);
+
+    const auto uncachedResult = decoder.decode(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(uncachedResult);
+    EXPECT_EQ(uncachedResult->instruction.type(), m68k::InstructionType::MOVEQ);
+}
+
+TEST(InstructionDecoderTests, writeToRamCodePageInvalidatesCache)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    bus->setCodeMemoryType(DataExchange::CodeMemoryType::WRITABLE);
+    bus->poke16(0x2000, NOP_OPCODE); //NOLINT(*-magic-numbers)
+    bus->poke16(0x2FFE, NOP_OPCODE); //NOLINT(*-magic-numbers)
+
+    m68k::InstructionDecoder decoder(bus);
+
+    ASSERT_TRUE(decoder.decodeCached(0x2000)); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(decoder.decodeCached(0x2FFE)); //NOLINT(*-magic-numbers)
+    EXPECT_TRUE(bus->isWatched(0x2000)); //NOLINT(*-magic-numbers)
+
+    ASSERT_TRUE(bus->write16(0x2FFE, MOVEQ_OPCODE)); //NOLINT(*-magic-numbers)
+    EXPECT_FALSE(bus->isWatched(0x2000)); //NOLINT(*-magic-numbers)
+
+    auto result = decoder.decodeCached(0x2FFE); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::MOVEQ);
+
+    /// the whole page was dropped and is watched again after the next decode
+    result = decoder.decodeCached(0x2000); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::NOP);
+    EXPECT_TRUE(bus->isWatched(0x2000)); //NOLINT(*-magic-numbers)
+}
+
+TEST(InstructionDecoderTests, uncacheableCodeIsAlwaysDecoded)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    bus->poke16(0x100, NOP_OPCODE); //NOLINT(*-magic-numbers)
+
+    m68k::InstructionDecoder decoder(bus);
+
+    auto result = decoder.decodeCached(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::NOP);
+
+    bus->poke16(0x100, MOVEQ_OPCODE); //NOLINT(*-magic-numbers)
+
+    result = decoder.decodeCached(0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::MOVEQ);
+}
+
+TEST(InstructionDecoderTests, logicalShiftsKeepTheirDirection)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    //NOLINTBEGIN(*-magic-numbers)
+    bus->poke16(0x100, 0xE248); /// LSR.W #1,D0
+    bus->poke16(0x102, 0xE2D0); /// LSR.W (A0)
+    bus->poke16(0x104, 0xE348); /// LSL.W #1,D0
+    bus->poke16(0x106, 0xE3D0); /// LSL.W (A0)
+
+    m68k::InstructionDecoder decoder(bus);
+
+    const auto lsrRegister = decoder.decode(0x100);
+    const auto lsrMemory = decoder.decode(0x102);
+    const auto lslRegister = decoder.decode(0x104);
+    const auto lslMemory = decoder.decode(0x106);
+    //NOLINTEND(*-magic-numbers)
+    ASSERT_TRUE(lsrRegister);
+    ASSERT_TRUE(lsrMemory);
+    ASSERT_TRUE(lslRegister);
+    ASSERT_TRUE(lslMemory);
+    EXPECT_EQ(lsrRegister->instruction.type(), m68k::InstructionType::LSR_REG);
+    EXPECT_EQ(lsrMemory->instruction.type(), m68k::InstructionType::LSR_MEMORY);
+    EXPECT_EQ(lslRegister->instruction.type(), m68k::InstructionType::LSL_REG);
+    EXPECT_EQ(lslMemory->instruction.type(), m68k::InstructionType::LSL_MEMORY);
+}
+
+TEST(InstructionDecoderTests, spanIsDecodedWithoutBus)
+{
+    m68k::InstructionDecoder decoder(nullptr);
+    const std::array<uint16_t, 3> code{LEA_OPCODE, LEA_DISPLACEMENT, NOP_OPCODE};
+
+    const auto result = decoder.decodePacked(code, 0x1000); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::LEA);
+    EXPECT_EQ(result->lengthBytes, 4);
+    EXPECT_EQ(result->ea.extension(), 0xFFFFFFF8);
+
+    const auto nextResult = decoder.decodePacked(std::span(code).subspan(2), 0x1004); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(nextResult);
+    EXPECT_EQ(nextResult->type, m68k::InstructionType::NOP);
+
+    /// the extension word lies past the buffer and there is no bus to read it from
+    const auto truncatedResult = decoder.decode(std::span(code).first(1), 0x1000); //NOLINT(*-magic-numbers)
+    ASSERT_FALSE(truncatedResult);
+    EXPECT_EQ(truncatedResult.error(), m68k::DecodeError::MEMORY_READ_FAILURE);
+}
+
+TEST(InstructionDecoderTests, wordsPastSpanAreReadFromBus)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    bus->poke16(0x102, LEA_DISPLACEMENT); //NOLINT(*-magic-numbers)
+
+    m68k::InstructionDecoder decoder(bus);
+    const std::array<uint16_t, 1> code{LEA_OPCODE};
+
+    const auto result = decoder.decodePacked(code, 0x100); //NOLINT(*-magic-numbers)
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::LEA);
+    EXPECT_EQ(result->ea.extension(), 0xFFFFFFF8);
+}
+
+TEST(InstructionDecoderTests, moveDecodesSizeAndDestination)
+{
+    using m68k::AddressingMode;
+    using m68k::OperationSize;
+
+    m68k::InstructionDecoder decoder(nullptr);
+    //NOLINTBEGIN(*-magic-numbers)
+    /// MOVE.L (A0)+,(A1)+
+    const std::array<uint16_t, 1> moveLong{0x22D8};
+    /// MOVE.W D0,D7
+    const std::array<uint16_t, 1> moveWord{0x3E00};
+    /// MOVE.B D2,-(A3)
+    const std::array<uint16_t, 1> moveByte{0x1702};
+    /// MOVE.L #$12345678,(16,A2): the destination extension follows the immediate
+    const std::array<uint16_t, 4> moveExtensions{0x257C, 0x1234, 0x5678, 0x0010};
+
+    const auto longResult = decoder.decodePacked(moveLong, 0x100);
+    ASSERT_TRUE(longResult);
+    EXPECT_EQ(longResult->type, m68k::InstructionType::MOVE);
+    EXPECT_EQ(longResult->size, OperationSize::LONG);
+    EXPECT_EQ(longResult->ea.mode, AddressingMode::ADDRESS_WITH_POSTINCREMENT);
+    EXPECT_EQ(longResult->ea.reg, 0);
+    EXPECT_EQ(longResult->destinationEa.mode, AddressingMode::ADDRESS_WITH_POSTINCREMENT);
+    EXPECT_EQ(longResult->destinationEa.reg, 1);
+
+    const auto wordResult = decoder.decodePacked(moveWord, 0x100);
+    ASSERT_TRUE(wordResult);
+    EXPECT_EQ(wordResult->size, OperationSize::WORD);
+    EXPECT_EQ(wordResult->ea.mode, AddressingMode::DATA_REGISTER);
+    EXPECT_EQ(wordResult->destinationEa.mode, AddressingMode::DATA_REGISTER);
+    EXPECT_EQ(wordResult->destinationEa.reg, 7);
+
+    const auto byteResult = decoder.decodePacked(moveByte, 0x100);
+    ASSERT_TRUE(byteResult);
+    EXPECT_EQ(byteResult->size, OperationSize::BYTE);
+    EXPECT_EQ(byteResult->ea.reg, 2);
+    EXPECT_EQ(byteResult->destinationEa.mode, AddressingMode::ADDRESS_WITH_PREDECREMENT);
+    EXPECT_EQ(byteResult->destinationEa.reg, 3);
+
+    const auto extensionsResult = decoder.decodePacked(moveExtensions, 0x100);
+    ASSERT_TRUE(extensionsResult);
+    EXPECT_EQ(extensionsResult->lengthBytes, 8);
+    EXPECT_EQ(extensionsResult->ea.mode, AddressingMode::IMMEDIATE);
+    EXPECT_EQ(extensionsResult->ea.extension(), 0x12345678);
+    EXPECT_EQ(extensionsResult->destinationEa.mode, AddressingMode::ADDRESS_WITH_DISPLACEMENT);
+    EXPECT_EQ(extensionsResult->destinationEa.reg, 2);
+    EXPECT_EQ(extensionsResult->destinationEa.extension(), 0x10);
+    //NOLINTEND(*-magic-numbers)
+}
+
+} // namespace
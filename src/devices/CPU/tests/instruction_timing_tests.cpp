@@ -0,0 +1,81 @@
+#include <cpu/internal/instructions/instruction_timing.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+using m68k::packInstruction;
+using m68k::OperationSize;
+namespace InstructionData = m68k::InstructionData;
+namespace timing = m68k::timing;
+
+//NOLINTBEGIN(*-magic-numbers)
+TEST(InstructionTimingTests, moveAddsSourceAndDestinationTimes)
+{
+    const InstructionData::MOVE_InstructionData move{
+        .size = OperationSize::LONG,
+        .sourceAddressingModeData = m68k::AddressWithDisplacementModeData{.addressRegNum = 1, .displacement = 4},
+        .destinationAddressingModeData = m68k::AbsoluteLongModeData{.address = 0x1000}
+    };
+    EXPECT_EQ(packInstruction(move, 8).cycles, 32);
+
+    const InstructionData::MOVE_InstructionData moveToPredecrement{
+        .size = OperationSize::WORD,
+        .sourceAddressingModeData = m68k::DataRegisterModeData{.dataRegNum = 0},
+        .destinationAddressingModeData = m68k::AddressWithPredecrementModeData{.addressRegNum = 7}
+    };
+    EXPECT_EQ(packInstruction(moveToPredecrement, 2).cycles, 8);
+}
+
+TEST(InstructionTimingTests, twoOperandInstructionsDependOnDirection)
+{
+    /// ADD.L (A0)+,D0
+    EXPECT_EQ(packInstruction(InstructionData::ADD_InstructionData{.destOperandType = m68k::DestinationOperandType::DESTINATION_DN,
+                                                                   .size = OperationSize::LONG, .dataRegisterNumber = 0,
+                                                                   .addressingModeData = m68k::AddressWithPostincrementModeData{.addressRegNum = 0}}, 2).cycles, 14);
+    /// ADD.L D1,D0
+    EXPECT_EQ(packInstruction(InstructionData::ADD_InstructionData{.destOperandType = m68k::DestinationOperandType::DESTINATION_DN,
+                                                                   .size = OperationSize::LONG, .dataRegisterNumber = 0,
+                                                                   .addressingModeData = m68k::DataRegisterModeData{.dataRegNum = 1}}, 2).cycles, 8);
+    /// ADD.W D0,(A0)
+    EXPECT_EQ(packInstruction(InstructionData::ADD_InstructionData{.destOperandType = m68k::DestinationOperandType::DESTINATION_EA,
+                                                                   .size = OperationSize::WORD, .dataRegisterNumber = 0,
+                                                                   .addressingModeData = m68k::AddressModeData{.addressRegNum = 0}}, 2).cycles, 12);
+    /// ADDQ.W #1,A0
+    EXPECT_EQ(packInstruction(InstructionData::ADDQ_InstructionData{.size = OperationSize::WORD, .data = 1,
+                                                                    .addressingModeData = m68k::AddressRegisterModeData{.addressRegNum = 0}}, 2).cycles, 8);
+}
+
+TEST(InstructionTimingTests, decodeTimeExtrasAreIncluded)
+{
+    /// MOVEM.L (A7)+,D0-D3
+    EXPECT_EQ(packInstruction(InstructionData::MOVEM_InstructionData{.addressingModeData = m68k::AddressWithPostincrementModeData{.addressRegNum = 7},
+                                                                     .direction = InstructionData::MOVEM_InstructionData::Direction::MEM_TO_REG,
+                                                                     .size = OperationSize::LONG, .registerMask = 0x000F}, 4).cycles, 44);
+    /// LSL.W #8,D0: immediate count 0 encodes 8
+    EXPECT_EQ(packInstruction(InstructionData::LSL_Register_InstructionData{.countOrRegister = 0, .size = OperationSize::WORD,
+                                                                            .dataRegisterToBeShifted = 0,
+                                                                            .shiftMode = InstructionData::LSL_Register_InstructionData::ShiftMode::IMMEDIATE}, 2).cycles, 22);
+    /// LEA (8,A0),A1
+    EXPECT_EQ(packInstruction(InstructionData::LEA_InstructionData{.addrRegNumber = 1,
+                                                                   .addressingModeData = m68k::AddressWithDisplacementModeData{.addressRegNum = 0, .displacement = 8}}, 4).cycles, 8);
+}
+
+TEST(InstructionTimingTests, operandDependentTimes)
+{
+    EXPECT_EQ(timing::muluExtraCycles(0), 0);
+    EXPECT_EQ(timing::muluExtraCycles(0xFFFF), 32);
+    EXPECT_EQ(timing::mulsExtraCycles(0xFFFF), 2);
+
+    /// overflow is detected before the division loop
+    EXPECT_EQ(timing::divuCycles(0x00100000, 0x10), 10);
+    EXPECT_EQ(timing::divuCycles(0, 1), 136);
+    EXPECT_EQ(timing::divuCycles(0xFFFE0001, 0xFFFF), 76);
+    EXPECT_EQ(timing::divsCycles(0x00100000, 0x10), 16);
+    EXPECT_LE(timing::divsCycles(-1, 2), 158);
+
+    EXPECT_EQ(timing::shiftExtraCycles(65), 2);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
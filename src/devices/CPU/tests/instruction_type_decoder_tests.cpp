@@ -0,0 +1,60 @@
+#include <cpu/internal/instruction_decoder/instruction_type_decoder.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+TEST(InstructionTypeDecoderTests, dispatchTableMatchesResolverForEveryOpcode)
+{
+    const m68k::InstructionTypeDecoder decoder;
+
+    for(uint32_t opcode = 0; opcode < m68k::InstructionTypeDecoder::DISPATCH_TABLE_SIZE; ++opcode) {
+
+        const auto expected = m68k::InstructionTypeDecoder::resolve(static_cast<uint16_t>(opcode));
+        const auto actual = decoder.decode(static_cast<uint16_t>(opcode));
+
+        ASSERT_EQ(expected.has_value(), actual.has_value()) << "opcode: 0x" << std::hex << opcode;
+
+        if(expected) {
+            ASSERT_EQ(expected.value(), actual.value()) << "opcode: 0x" << std::hex << opcode;
+        } else {
+            ASSERT_EQ(expected.error(), actual.error()) << "opcode: 0x" << std::hex << opcode;
+        }
+    }
+}
+
+TEST(InstructionTypeDecoderTests, mostSpecificMaskWins)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    const m68k::InstructionTypeDecoder decoder;
+
+    auto result = decoder.decode(0x4E71); // NOP
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value(), m68k::InstructionType::NOP);
+
+    result = decoder.decode(0x003C); // ORI to CCR, also matches ORI
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value(), m68k::InstructionType::ORI_to_CCR);
+
+    result = decoder.decode(0x6000); // BRA, also matches Bcc
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value(), m68k::InstructionType::BRA);
+
+    result = decoder.decode(0x4AFC); // ILLEGAL, also matches TST and TAS
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value(), m68k::InstructionType::ILLEGAL);
+    //NOLINTEND(*-magic-numbers)
+}
+
+TEST(InstructionTypeDecoderTests, unknownOpcodeIsInvalid)
+{
+    //NOLINTBEGIN(*-magic-numbers)
+    const m68k::InstructionTypeDecoder decoder;
+
+    auto result = decoder.decode(0xA000); // line A emulator
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::DecodeError::INVALID_INSTRUCTION);
+
+    result = decoder.decode(0xF000); // line F emulator
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::DecodeError::INVALID_INSTRUCTION);
+    //NOLINTEND(*-magic-numbers)
+}
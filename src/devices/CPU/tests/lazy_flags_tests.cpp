@@ -0,0 +1,85 @@
+#include <cpu/internal/instruction_executor/lazy_flags.h>
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace {
+
+using m68k::OperationSize;
+using m68k::executors_::LazyFlags;
+
+//NOLINTBEGIN(*-magic-numbers)
+TEST(LazyFlagsTests, flagsAreWrittenOnlyWhenMaterialized)
+{
+    LazyFlags flags;
+    m68k_::StatusRegister sr{};
+
+    flags.setLogic(OperationSize::LONG, 0);
+    EXPECT_TRUE(flags.pending());
+    EXPECT_FALSE(sr.zero());
+
+    EXPECT_TRUE(flags.materialize(sr).zero());
+    EXPECT_FALSE(flags.pending());
+
+    /// nothing pending: SR written directly is kept
+    sr.setZero(false);
+    EXPECT_FALSE(flags.materialize(sr).zero());
+}
+
+TEST(LazyFlagsTests, additionCarryAndOverflowFollowTheSize)
+{
+    LazyFlags flags;
+    m68k_::StatusRegister sr{};
+
+    /// 0x7F + 0x01 overflows a byte but not a word
+    flags.setAdd(OperationSize::BYTE, 0x01, 0x7F, 0x80);
+    flags.materialize(sr);
+    EXPECT_TRUE(sr.overflow());
+    EXPECT_TRUE(sr.negative());
+    EXPECT_FALSE(sr.carry());
+
+    flags.setAdd(OperationSize::WORD, 0x01, 0x7F, 0x80);
+    flags.materialize(sr);
+    EXPECT_FALSE(sr.overflow());
+    EXPECT_FALSE(sr.negative());
+
+    /// 0xFFFF + 1 carries out of a word, the bits above the size are ignored
+    flags.setAdd(OperationSize::WORD, 0x0001, 0x1234FFFF, 0x12350000);
+    flags.materialize(sr);
+    EXPECT_TRUE(sr.carry());
+    EXPECT_TRUE(sr.extend());
+    EXPECT_TRUE(sr.zero());
+    EXPECT_FALSE(sr.overflow());
+}
+
+TEST(LazyFlagsTests, subtractionBorrowsAndCompareKeepsExtend)
+{
+    LazyFlags flags;
+    m68k_::StatusRegister sr{};
+
+    /// 0 - 1 borrows
+    flags.setSub(OperationSize::LONG, 1, 0, 0xFFFFFFFF);
+    flags.materialize(sr);
+    EXPECT_TRUE(sr.carry());
+    EXPECT_TRUE(sr.extend());
+    EXPECT_TRUE(sr.negative());
+    EXPECT_FALSE(sr.overflow());
+
+    /// 0x80000000 - 1 overflows; CMP leaves X as the SUB set it
+    flags.setCompare(OperationSize::LONG, 1, 0x80000000, 0x7FFFFFFF);
+    flags.materialize(sr);
+    EXPECT_TRUE(sr.overflow());
+    EXPECT_FALSE(sr.carry());
+    EXPECT_FALSE(sr.negative());
+    EXPECT_TRUE(sr.extend());
+
+    flags.setLogic(OperationSize::BYTE, 0x180);
+    flags.materialize(sr);
+    EXPECT_TRUE(sr.negative());
+    EXPECT_FALSE(sr.overflow());
+    EXPECT_FALSE(sr.carry());
+    EXPECT_TRUE(sr.extend());
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
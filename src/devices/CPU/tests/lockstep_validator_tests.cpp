@@ -0,0 +1,141 @@
+#include <cpu/lockstep_validator.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+
+//NOLINTBEGIN(*-magic-numbers)
+class LockstepValidatorTests : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (auto& bus : {primaryBus_, referenceBus_}) {
+            bus->setCodeMemoryType(DataExchange::CodeMemoryType::READ_ONLY);
+            pokeLong(*bus, 0, 0x8000);       ///< SSP
+            pokeLong(*bus, 4, 0x100);        ///< PC
+            pokeLong(*bus, 30 * 4, 0x600);   ///< level 6 autovector
+            pokeLong(*bus, 32 * 4, 0x400);   ///< TRAP #0
+
+            bus->poke16(0x100, 0x7009);      ///< MOVEQ #9,D0
+            bus->poke16(0x102, 0x7201);      ///< loop: MOVEQ #1,D1
+            bus->poke16(0x104, 0x74FF);      ///< MOVEQ #-1,D2
+            bus->poke16(0x106, 0x6B02);      ///< BMI.S skip
+            bus->poke16(0x108, 0x4E71);      ///< NOP
+            bus->poke16(0x10A, 0x51C8);      ///< skip: DBF D0,loop
+            bus->poke16(0x10C, 0xFFF6);
+            bus->poke16(0x10E, 0x4E40);      ///< TRAP #0
+
+            bus->poke16(0x400, 0x7607);      ///< MOVEQ #7,D3
+            bus->poke16(0x402, 0x6000);      ///< BRA.W 0x100
+            bus->poke16(0x404, 0xFCFC);
+
+            bus->poke16(0x600, 0x7806);      ///< MOVEQ #6,D4
+            bus->poke16(0x602, 0x6000);      ///< BRA.W 0x100
+            bus->poke16(0x604, 0xFAFC);
+        }
+
+        validator_ = std::make_unique<m68k::LockstepValidator>(primaryBus_, referenceBus_);
+    }
+
+    static void pokeLong(FakeMemoryBus& bus, uint32_t address, uint32_t value)
+    {
+        bus.poke16(address, static_cast<uint16_t>(value >> 16U));
+        bus.poke16(address + 2, static_cast<uint16_t>(value));
+    }
+
+    std::shared_ptr<FakeMemoryBus> primaryBus_ = std::make_shared<FakeMemoryBus>();
+    std::shared_ptr<FakeMemoryBus> referenceBus_ = std::make_shared<FakeMemoryBus>();
+    std::unique_ptr<m68k::LockstepValidator> validator_;
+};
+
+TEST_F(LockstepValidatorTests, blockEngineMatchesTheInterpreter)
+{
+    ASSERT_TRUE(validator_->reset());
+    validator_->primary().registers().SR().setInterruptMask(0);
+    validator_->reference().registers().SR().setInterruptMask(0);
+    /// the exception frames pushed by TRAP and the interrupt
+    validator_->compareMemory(0x7000, 0x1000);
+
+    for (int step = 0; step < 300; ++step) {
+        if (step == 100) {
+            validator_->raiseIPL(6);
+        }
+        if (step == 110) {
+            validator_->lowerIPL(6);
+        }
+        ASSERT_TRUE(validator_->step()) << "step " << step;
+    }
+
+    /// more instructions than blocks, with the loop translated long ago
+    EXPECT_GT(validator_->primary().steps(), 300);
+    EXPECT_EQ(validator_->primary().registers().D(3), 7);
+    EXPECT_EQ(validator_->primary().registers().D(4), 6);
+}
+
+TEST_F(LockstepValidatorTests, registerOnlyRunsMatchTheInterpreter)
+{
+    for (auto& bus : {primaryBus_, referenceBus_}) {
+        bus->poke16(0x800, 0x7080);     ///< loop: MOVEQ #-128,D0
+        bus->poke16(0x802, 0x2200);     ///< MOVE.L D0,D1
+        bus->poke16(0x804, 0x323C);     ///< MOVE.W #$0000,D1
+        bus->poke16(0x806, 0x0000);
+        bus->poke16(0x808, 0x1400);     ///< MOVE.B D0,D2
+        bus->poke16(0x80A, 0x263C);     ///< MOVE.L #$12345678,D3
+        bus->poke16(0x80C, 0x1234);
+        bus->poke16(0x80E, 0x5678);
+        bus->poke16(0x810, 0x3803);     ///< MOVE.W D3,D4
+        bus->poke16(0x812, 0x1A3C);     ///< MOVE.B #$80,D5
+        bus->poke16(0x814, 0x0080);
+        bus->poke16(0x816, 0x2C05);     ///< MOVE.L D5,D6
+        bus->poke16(0x818, 0x3C07);     ///< MOVE.W D7,D6, the eighth data register
+        bus->poke16(0x81A, 0x2006);     ///< MOVE.L D6,D0
+        bus->poke16(0x81C, 0x6602);     ///< BNE.S skip
+        bus->poke16(0x81E, 0x4E71);     ///< NOP
+        bus->poke16(0x820, 0x51CF);     ///< skip: DBF D7,loop
+        bus->poke16(0x822, 0xFFDE);
+        bus->poke16(0x824, 0x4E40);     ///< TRAP #0
+    }
+    ASSERT_TRUE(validator_->reset());
+    for (auto* cpu : {&validator_->primary(), &validator_->reference()}) {
+        cpu->registers().PC() = 0x800;
+        cpu->registers().D(7) = 40;
+    }
+
+    for (int step = 0; step < 200; ++step) {
+        ASSERT_TRUE(validator_->step()) << "step " << step;
+    }
+    EXPECT_EQ(validator_->primary().registers().D(4), 0x5678);
+    EXPECT_EQ(validator_->primary().registers().D(3), 7);
+}
+
+TEST_F(LockstepValidatorTests, registerMismatchIsReported)
+{
+    referenceBus_->poke16(0x100, 0x7008); ///< MOVEQ #8,D0
+    ASSERT_TRUE(validator_->reset());
+
+    const auto result = validator_->step();
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::LockstepError::REGISTERS_DIFFER);
+    EXPECT_EQ(validator_->divergence().blockPc, 0x100);
+    EXPECT_EQ(validator_->divergence().primary.D(0), 9);
+    EXPECT_EQ(validator_->divergence().reference.D(0), 8);
+}
+
+TEST_F(LockstepValidatorTests, memoryMismatchIsReported)
+{
+    referenceBus_->poke16(0x7000, 0x0100);
+    ASSERT_TRUE(validator_->reset());
+    validator_->compareMemory(0x7000, 0x10);
+
+    const auto result = validator_->step();
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), m68k::LockstepError::MEMORY_DIFFERS);
+    EXPECT_EQ(validator_->divergence().address, 0x7000);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
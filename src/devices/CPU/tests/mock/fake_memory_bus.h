@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memoryinterface.h>
+#include <set>
+#include <vector>
+
+namespace m68k::InstructionDecoderTest {
+
+/// 64 KB of big-endian memory with configurable code memory type, page write tracking and device-like addresses
+class FakeMemoryBus : public DataExchange::MemoryInterface {
+public:
+    static constexpr uint32_t MEMORY_SIZE = 0x10000;
+    static constexpr uint32_t PAGE_SIZE = 0x1000;
+
+    std::expected<DataExchange::MemoryAccessResult, DataExchange::MemoryAccessError> read16(uint32_t address) const override
+    {
+        if (address + 1 >= MEMORY_SIZE) {
+            return std::unexpected(DataExchange::MemoryAccessError::READ_FROM_UNMAPPED_ADDRESS);
+        }
+
+        return DataExchange::MemoryAccessResult{
+            .data = static_cast<uint16_t>((memory_[address] << 8U) | memory_[address + 1]), //NOLINT
+            .waitCycles = 0
+        };
+    }
+
+    std::expected<void, DataExchange::MemoryAccessError> write16(uint32_t address, uint16_t value) override
+    {
+        if (address + 1 >= MEMORY_SIZE) {
+            return std::unexpected(DataExchange::MemoryAccessError::WRITE_TO_UNMAPPED_ADDRESS);
+        }
+
+        const uint32_t pageStart = address & ~(PAGE_SIZE - 1);
+        if (watchedPages_.erase(pageStart) != 0) {
+            for (auto* listener : listeners_) {
+                listener->onCodeWrite(pageStart, PAGE_SIZE);
+            }
+        }
+
+        poke16(address, value);
+        return {};
+    }
+
+    /// Direct memory is everything but device-like addresses
+    bool copyMemory(uint32_t destination, uint32_t source, uint32_t length) override
+    {
+        if ((destination > source && destination - source < length) || !isPlainMemory(source, length) || !isPlainMemory(destination, length)) {
+            return false;
+        }
+
+        notifyCodeWrites(destination, length);
+        std::memmove(&memory_[destination], &memory_[source], length);
+        ++bulkOperationsCount_;
+        return true;
+    }
+
+    bool fillMemory(uint32_t destination, uint32_t length, std::span<const uint8_t> pattern) override
+    {
+        if (pattern.empty() || !isPlainMemory(destination, length)) {
+            return false;
+        }
+
+        notifyCodeWrites(destination, length);
+        for (uint32_t i = 0; i < length; ++i) {
+            memory_[destination + i] = pattern[i % pattern.size()];
+        }
+        ++bulkOperationsCount_;
+        return true;
+    }
+
+    DataExchange::CodeMemoryType codeMemoryType(uint32_t /*address*/) const override { return codeMemoryType_; }
+    void watchCodeWrites(uint32_t address) override { watchedPages_.insert(address & ~(PAGE_SIZE - 1)); }
+    void addCodeWriteListener(DataExchange::CodeWriteListener* listener) override { listeners_.push_back(listener); }
+    void removeCodeWriteListener(DataExchange::CodeWriteListener* listener) override { std::erase(listeners_, listener); }
+    bool readHasSideEffects(uint32_t address) const override { return sideEffectAddresses_.contains(address); }
+
+    /// Store a word without notifying the listener, like a write the bus cannot see
+    void poke16(uint32_t address, uint16_t value)
+    {
+        memory_[address] = static_cast<uint8_t>(value >> 8U); //NOLINT
+        memory_[address + 1] = static_cast<uint8_t>(value);
+    }
+
+    void setCodeMemoryType(DataExchange::CodeMemoryType type) { codeMemoryType_ = type; }
+    /// Make reads of address behave like a device register
+    void markReadSideEffects(uint32_t address) { sideEffectAddresses_.insert(address); }
+    [[nodiscard]] bool isWatched(uint32_t address) const { return watchedPages_.contains(address & ~(PAGE_SIZE - 1)); }
+    [[nodiscard]] size_t listenersCount() const { return listeners_.size(); }
+    [[nodiscard]] size_t bulkOperationsCount() const { return bulkOperationsCount_; }
+
+private:
+    [[nodiscard]] bool isPlainMemory(uint32_t address, uint32_t length) const
+    {
+        return length != 0 && static_cast<uint64_t>(address) + length <= MEMORY_SIZE &&
+               sideEffectAddresses_.lower_bound(address) == sideEffectAddresses_.lower_bound(address + length);
+    }
+
+    void notifyCodeWrites(uint32_t address, uint32_t length)
+    {
+        for (uint32_t pageStart = address & ~(PAGE_SIZE - 1); pageStart < address + length; pageStart += PAGE_SIZE) {
+            if (watchedPages_.erase(pageStart) != 0) {
+                for (auto* listener : listeners_) {
+                    listener->onCodeWrite(pageStart, PAGE_SIZE);
+                }
+            }
+        }
+    }
+
+    std::vector<uint8_t> memory_ = std::vector<uint8_t>(MEMORY_SIZE);
+    DataExchange::CodeMemoryType codeMemoryType_ = DataExchange::CodeMemoryType::UNCACHEABLE;
+    std::set<uint32_t> watchedPages_;
+    std::set<uint32_t> sideEffectAddresses_;
+    std::vector<DataExchange::CodeWriteListener*> listeners_;
+    size_t bulkOperationsCount_ = 0;
+};
+
+} // namespace m68k::InstructionDecoderTest
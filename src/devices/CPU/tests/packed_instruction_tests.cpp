@@ -0,0 +1,103 @@
+#include <cpu/internal/instruction_decoder/instruction_decoder.h>
+#include <cpu/internal/instructions/packed_instruction.h>
+#include <cstdint>
+#include <fake_memory_bus.h>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+using m68k::AddressingMode;
+using m68k::packInstruction;
+using m68k::InstructionDecoderTest::FakeMemoryBus;
+namespace InstructionData = m68k::InstructionData;
+
+//NOLINTBEGIN(*-magic-numbers)
+TEST(PackedInstructionTests, moveKeepsBothEffectiveAddresses)
+{
+    const InstructionData::MOVE_InstructionData move{
+        .size = m68k::OperationSize::LONG,
+        .sourceAddressingModeData = m68k::AddressWithIndexModeData{
+            .addressRegNum = 2,
+            .extensionWord = {.displacement = -4,
+                              .indexSize = m68k::IndexedMode::IndexSize::LONG,
+                              .registerType = m68k::IndexedMode::RegisterType::ADDRESS_REGISTER,
+                              .registerNum = 5}},
+        .destinationAddressingModeData = m68k::AbsoluteShortModeData{.address = 0x8000}
+    };
+
+    const auto packed = packInstruction(move, 6);
+    EXPECT_EQ(packed.type, m68k::InstructionType::MOVE);
+    EXPECT_EQ(packed.size, m68k::OperationSize::LONG);
+    EXPECT_EQ(packed.lengthBytes, 6);
+
+    EXPECT_EQ(packed.ea.mode, AddressingMode::ADDRESS_WITH_INDEX);
+    EXPECT_EQ(packed.ea.reg, 2);
+    EXPECT_EQ(packed.ea.indexDisplacement(), -4);
+    EXPECT_EQ(packed.ea.indexRegister(), 5);
+    EXPECT_TRUE(packed.ea.indexIsAddressRegister());
+    EXPECT_EQ(packed.ea.indexRegisterField(), 13);
+    EXPECT_TRUE(packed.ea.indexIsLong());
+
+    /// absolute short addresses are sign-extended
+    EXPECT_EQ(packed.destinationEa.mode, AddressingMode::ABSOLUTE_SHORT);
+    EXPECT_EQ(packed.destinationEa.extension(), 0xFFFF8000);
+}
+
+TEST(PackedInstructionTests, immediatesAndDisplacementsAreSignExtended)
+{
+    auto packed = packInstruction(InstructionData::MOVEQ_InstructionData{.dataRegNumber = 4, .data = -1}, 2);
+    EXPECT_EQ(packed.reg, 4);
+    EXPECT_EQ(packed.immediate, -1);
+
+    packed = packInstruction(InstructionData::Bcc_InstructionData{.condition = m68k::Condition::LESS_THAN,
+                                                                  .displacement = static_cast<int16_t>(-0x100)}, 4);
+    EXPECT_EQ(packed.condition(), m68k::Condition::LESS_THAN);
+    EXPECT_EQ(packed.immediate, -0x100);
+
+    packed = packInstruction(InstructionData::ADDI_InstructionData{.size = m68k::OperationSize::LONG,
+                                                                   .addressingModeData = m68k::AddressWithDisplacementModeData{.addressRegNum = 6, .displacement = -2},
+                                                                   .immediateData = static_cast<uint32_t>(0x80000000)}, 8);
+    EXPECT_EQ(static_cast<uint32_t>(packed.immediate), 0x80000000);
+    EXPECT_EQ(packed.ea.mode, AddressingMode::ADDRESS_WITH_DISPLACEMENT);
+    EXPECT_EQ(packed.ea.reg, 6);
+    EXPECT_EQ(packed.ea.extension(), 0xFFFFFFFE);
+}
+
+TEST(PackedInstructionTests, registerPairsUseBothRegisterFields)
+{
+    auto packed = packInstruction(InstructionData::MOVEP_InstructionData{.displacement = 8, .dataRegNumber = 1, .addrRegNumber = 3,
+                                                                         .mode = InstructionData::MOVEP_InstructionData::OpMode::LONG_REG_TO_MEM}, 4);
+    EXPECT_EQ(packed.reg, 1);
+    EXPECT_EQ(packed.reg2, 3);
+    EXPECT_EQ(packed.immediate, 8);
+    EXPECT_EQ(packed.paramAs<InstructionData::MOVEP_InstructionData::OpMode>(), InstructionData::MOVEP_InstructionData::OpMode::LONG_REG_TO_MEM);
+
+    packed = packInstruction(InstructionData::ADDX_InstructionData{.operandAddressingMode = m68k::OperandAddressingMode::MEM_TO_MEM,
+                                                                   .size = m68k::OperationSize::BYTE,
+                                                                   .destinationRegister = 7, .sourceRegister = 2}, 2);
+    EXPECT_EQ(packed.reg, 7);
+    EXPECT_EQ(packed.reg2, 2);
+    EXPECT_EQ(packed.paramAs<m68k::OperandAddressingMode>(), m68k::OperandAddressingMode::MEM_TO_MEM);
+}
+
+TEST(PackedInstructionTests, decoderPacksExtensionWords)
+{
+    auto bus = std::make_shared<FakeMemoryBus>();
+    /// LEA (-8,A0),A1
+    bus->poke16(0x100, 0x43E8);
+    bus->poke16(0x102, 0xFFF8);
+
+    m68k::InstructionDecoder decoder(bus);
+    const auto result = decoder.decodePacked(0x100);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->type, m68k::InstructionType::LEA);
+    EXPECT_EQ(result->lengthBytes, 4);
+    EXPECT_EQ(result->reg, 1);
+    EXPECT_EQ(result->ea.mode, AddressingMode::ADDRESS_WITH_DISPLACEMENT);
+    EXPECT_EQ(result->ea.reg, 0);
+    EXPECT_EQ(result->ea.extension(), 0xFFFFFFF8);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
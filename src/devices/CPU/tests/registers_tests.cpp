@@ -0,0 +1,64 @@
+#include <cpu/internal/registers.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace {
+
+//NOLINTBEGIN(*-magic-numbers)
+TEST(RegistersTests, registerFieldIndexesDataThenAddressRegisters)
+{
+    m68k_::Registers regs{};
+    regs.D(3) = 0x33;
+    regs.A(5) = 0xA5;
+
+    EXPECT_EQ(regs.R(3), 0x33);
+    EXPECT_EQ(regs.R(13), 0xA5);
+    EXPECT_EQ(&regs.R(15), &regs.A(7));
+}
+
+TEST(RegistersTests, stackPointersAreBankedOnSupervisorChange)
+{
+    m68k_::Registers regs{};
+    regs.setSupervisorState(true);
+    regs.SSP() = 0x8000;
+    regs.USP() = 0x4000;
+    EXPECT_EQ(regs.A(7), 0x8000);
+
+    regs.setSupervisorState(false);
+    EXPECT_FALSE(regs.SR().supervisorOrUserState());
+    EXPECT_EQ(regs.A(7), 0x4000);
+    EXPECT_EQ(regs.SSP(), 0x8000);
+
+    /// setting the same state again swaps nothing
+    regs.setSupervisorState(false);
+    EXPECT_EQ(regs.A(7), 0x4000);
+
+    regs.A(7) -= 4;
+    regs.setSupervisorState(true);
+    EXPECT_EQ(regs.A(7), 0x8000);
+    EXPECT_EQ(regs.USP(), 0x3FFC);
+}
+
+TEST(RegistersTests, statusRegisterKeepsThe68000Layout)
+{
+    m68k_::Registers regs{};
+    regs.setSupervisorState(true);
+    auto& sr = regs.SR();
+
+    sr.setWord(0x271F);
+    EXPECT_EQ(sr.word(), 0x271F);
+    EXPECT_EQ(sr.interruptMask(), 7);
+    EXPECT_TRUE(sr.extend());
+    EXPECT_TRUE(sr.carry());
+
+    /// unimplemented bits read as zero, S only changes with the stack pointers
+    sr.setWord(0x08E0);
+    EXPECT_EQ(sr.word(), 0x2000);
+
+    sr.setConditionCodes(m68k_::StatusRegister::ZERO_BIT | m68k_::StatusRegister::EXTEND_BIT,
+                         m68k_::StatusRegister::ZERO_BIT | m68k_::StatusRegister::NEGATIVE_BIT);
+    EXPECT_EQ(sr.word(), 0x2004);
+}
+//NOLINTEND(*-magic-numbers)
+
+} // namespace
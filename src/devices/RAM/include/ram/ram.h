@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <ibusdevice.h>
+#include <span>
+#include <vector>
+
+/**
+ * @file ram.h
+ * @brief Zero-initialised read/write memory implementing DataExchange::IBusDevice.
+ *
+ * RAM holds a fixed-size byte buffer in m68k (big-endian) byte order. It is
+ * intended to represent work RAM regions of the emulated system.
+ *
+ * Behaviour notes:
+ *  - read8()/read16()/read32() and their write counterparts access big-endian
+ *    values at a byte address and throw std::out_of_range when accessing past
+ *    the end of the buffer.
+ *  - The buffer is exposed via readableMemory()/writableMemory(), so the bus
+ *    normally accesses it directly without calling read16()/write16().
+ *
+ * Thread-safety: this class is not synchronized — callers must ensure safe
+ * concurrent access if used from multiple threads.
+ *
+ * Example:
+ * @code
+ * DataExchange::RAM workRam(0x10000);
+ * workRam.write16(0x100, 0x4E71);
+ * @endcode
+ */
+
+namespace DataExchange {
+
+class RAM : public DataExchange::IBusDevice {
+public:
+    /**
+     * @brief Construct zero-filled RAM.
+     * @param sizeBytes Size of the memory in bytes.
+     */
+    explicit RAM(size_t sizeBytes);
+
+    /**
+     * @brief Read a 16-bit big-endian word from RAM.
+     * @param address Byte address within RAM.
+     * @throws std::out_of_range if address+1 is outside the buffer.
+     */
+    uint16_t read16(uint32_t address) override;
+
+    /**
+     * @brief Write a 16-bit big-endian word to RAM.
+     * @param address Byte address within RAM.
+     * @param value 16-bit value to store.
+     * @throws std::out_of_range if address+1 is outside the buffer.
+     */
+    void write16(uint32_t address, uint16_t value) override;
+
+    /**
+     * @brief Read a byte from RAM.
+     * @throws std::out_of_range if address is outside the buffer.
+     */
+    uint8_t read8(uint32_t address) override;
+
+    /**
+     * @brief Write a byte to RAM.
+     * @throws std::out_of_range if address is outside the buffer.
+     */
+    void write8(uint32_t address, uint8_t value) override;
+
+    /**
+     * @brief Read a 32-bit big-endian long from RAM.
+     * @throws std::out_of_range if address+3 is outside the buffer.
+     */
+    uint32_t read32(uint32_t address) override;
+
+    /**
+     * @brief Write a 32-bit big-endian long to RAM.
+     * @throws std::out_of_range if address+3 is outside the buffer.
+     */
+    void write32(uint32_t address, uint32_t value) override;
+
+    /** @brief Whole RAM buffer, readable directly by the bus. */
+    std::span<const std::byte> readableMemory() override;
+
+    /** @brief Whole RAM buffer, writable directly by the bus. */
+    std::span<std::byte> writableMemory() override;
+
+private:
+    void checkAccess(uint32_t address, size_t accessSize, const char* message) const;
+
+    std::vector<std::byte> ramData_; ///< RAM contents in big-endian byte order.
+};
+
+} // namespace DataExchange
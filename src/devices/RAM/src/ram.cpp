@@ -0,0 +1,66 @@
+#include "ram/ram.h"
+#include <big_endian.h>
+#include <stdexcept>
+#include <string>
+
+namespace DataExchange {
+
+RAM::RAM(size_t sizeBytes) : ramData_(sizeBytes)
+{
+
+}
+
+uint16_t RAM::read16(uint32_t address)
+{
+    checkAccess(address, sizeof(uint16_t), "Попытка чтения за пределами RAM: ");
+    return loadBigEndian<uint16_t>(&ramData_[address]);
+}
+
+void RAM::write16(uint32_t address, uint16_t value)
+{
+    checkAccess(address, sizeof(uint16_t), "Попытка записи за пределами RAM: ");
+    storeBigEndian(&ramData_[address], value);
+}
+
+uint8_t RAM::read8(uint32_t address)
+{
+    checkAccess(address, sizeof(uint8_t), "Попытка чтения за пределами RAM: ");
+    return std::to_integer<uint8_t>(ramData_[address]);
+}
+
+void RAM::write8(uint32_t address, uint8_t value)
+{
+    checkAccess(address, sizeof(uint8_t), "Попытка записи за пределами RAM: ");
+    ramData_[address] = static_cast<std::byte>(value);
+}
+
+uint32_t RAM::read32(uint32_t address)
+{
+    checkAccess(address, sizeof(uint32_t), "Попытка чтения за пределами RAM: ");
+    return loadBigEndian<uint32_t>(&ramData_[address]);
+}
+
+void RAM::write32(uint32_t address, uint32_t value)
+{
+    checkAccess(address, sizeof(uint32_t), "Попытка записи за пределами RAM: ");
+    storeBigEndian(&ramData_[address], value);
+}
+
+void RAM::checkAccess(uint32_t address, size_t accessSize, const char* message) const
+{
+    if (static_cast<size_t>(address) + accessSize > ramData_.size()) {
+        throw std::out_of_range(message + std::to_string(address));
+    }
+}
+
+std::span<const std::byte> RAM::readableMemory()
+{
+    return ramData_;
+}
+
+std::span<std::byte> RAM::writableMemory()
+{
+    return ramData_;
+}
+
+} // namespace DataExchange
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <ram/ram.h>
+
+TEST(RAMDeviceTest, IsZeroInitialised) {
+    DataExchange::RAM ram(16); //NOLINT
+
+    for (uint32_t address = 0; address < 16; address += 2) { //NOLINT
+        EXPECT_EQ(ram.read16(address), 0);
+    }
+}
+
+TEST(RAMDeviceTest, WritesAndReadsBigEndianWords) {
+    DataExchange::RAM ram(16); //NOLINT
+
+    ram.write16(4, 0x1234); //NOLINT
+    EXPECT_EQ(ram.read16(4), 0x1234); //NOLINT
+
+    const auto memory = ram.readableMemory();
+    ASSERT_EQ(memory.size(), 16); //NOLINT
+    EXPECT_EQ(memory[4], std::byte{0x12}); //NOLINT
+    EXPECT_EQ(memory[5], std::byte{0x34}); //NOLINT
+}
+
+TEST(RAMDeviceTest, WritableMemoryIsVisibleToReads) {
+    DataExchange::RAM ram(16); //NOLINT
+
+    auto memory = ram.writableMemory();
+    memory[8] = std::byte{0xAB}; //NOLINT
+    memory[9] = std::byte{0xCD}; //NOLINT
+
+    EXPECT_EQ(ram.read16(8), 0xABCD); //NOLINT
+}
+
+TEST(RAMDeviceTest, ThrowsOnOutOfBoundsAccess) {
+    DataExchange::RAM ram(16); //NOLINT
+
+    EXPECT_THROW(ram.read16(15), std::out_of_range); //NOLINT
+    EXPECT_THROW(ram.write16(16, 0), std::out_of_range); //NOLINT
+}
+
+TEST(RAMDeviceTest, ByteAndLongAccesses) {
+    DataExchange::RAM ram(16); //NOLINT
+
+    ram.write32(8, 0x12345678); //NOLINT
+    EXPECT_EQ(ram.read32(8), 0x12345678); //NOLINT
+    EXPECT_EQ(ram.read16(10), 0x5678); //NOLINT
+
+    ram.write8(9, 0xAB); //NOLINT
+    EXPECT_EQ(ram.read8(8), 0x12); //NOLINT
+    EXPECT_EQ(ram.read8(9), 0xAB); //NOLINT
+    EXPECT_EQ(ram.read32(8), 0x12AB5678); //NOLINT
+
+    EXPECT_NO_THROW(ram.read32(12)); //NOLINT
+    EXPECT_THROW(ram.read32(13), std::out_of_range); //NOLINT
+    EXPECT_THROW(ram.write8(16, 0), std::out_of_range); //NOLINT
+}
@@ -1,23 +1,32 @@
 #pragma once
 #include <cstddef>
 #include <ibusdevice.h>
+#include <optional>
+#include <rom/mapped_file.h>
+#include <span>
 #include <vector>
 
 /**
  * @file filerom.h
  * @brief File-backed read-only ROM device implementing DataExchange::IBusDevice.
  *
- * FileROM maps a binary file into an internal byte buffer and exposes 16-bit
- * big-endian read accesses via the IBusDevice interface. It is intended to
- * represent cartridge or BIOS ROM regions for the emulator.
+ * FileROM maps a binary file into memory and exposes big-endian read accesses
+ * via the IBusDevice interface. It is intended to represent cartridge or BIOS
+ * ROM regions for the emulator.
  *
  * Behaviour notes:
- *  - Constructor loads the entire file into memory and throws std::runtime_error
- *    on open/read failure.
+ *  - By default the file is mapped read-only with MAP_PRIVATE, so emulator
+ *    instances running the same image share the page cache and startup does not
+ *    copy the image. If the file cannot be mapped (empty file, no mmap() on the
+ *    platform) or ROMLoadMode::COPY is requested, the image is copied into an
+ *    internal buffer instead.
+ *  - Constructor throws std::runtime_error on open/read failure.
  *  - read16() assembles a big-endian 16-bit word from two consecutive bytes
  *    and throws std::out_of_range when accessing past the end of the image.
  *  - write16() is defined but the ROM is read-only; current behaviour is to
  *    ignore writes (implementations may choose to throw instead).
+ *  - The image is exposed via readableMemory(), so the bus normally reads it
+ *    directly without calling read16().
  *
  * Thread-safety: this class is not synchronized — callers must ensure safe
  * concurrent access if used from multiple threads.
@@ -31,24 +40,31 @@
 
 namespace DataExchange {
 
+/// How FileROM brings the image into memory
+enum class ROMLoadMode : uint8_t {
+    MEMORY_MAP, ///< read-only private mapping, falls back to COPY when mapping fails
+    COPY,       ///< private copy in a std::vector
+    HOST_WORDS  ///< copy converted once to host-endian 16-bit words, mirrored by address mask
+};
 
 class FileROM : public DataExchange::IBusDevice {
 public:
     /**
     * @brief Construct and load ROM from file.
     * @param filepath Path to the ROM binary to load.
+    * @param mode Load mode, see ROMLoadMode.
     *
-    * Loads the entire file into an internal std::vector<std::byte>. Throws
-    * std::runtime_error if the file cannot be opened or read.
+    * Throws std::runtime_error if the file cannot be opened or read.
     */
-    explicit FileROM(const char* filepath);
+    explicit FileROM(const char* filepath, ROMLoadMode mode = ROMLoadMode::MEMORY_MAP);
 
     /**
      * @brief Read a 16-bit big-endian word from the ROM.
      * @param address Byte address within the ROM image.
-     * @return 16-bit word assembled from romData_[address] (high byte) and
-     *         romData_[address+1] (low byte).
-     * @throws std::out_of_range if address+1 is outside the loaded image.
+     * @return 16-bit word assembled from image[address] (high byte) and
+     *         image[address+1] (low byte).
+     * @throws std::out_of_range if address+1 is outside the loaded image
+     *         (except in ROMLoadMode::HOST_WORDS, which mirrors instead).
      */
     uint16_t read16(uint32_t address) override;
 
@@ -61,7 +77,40 @@ public:
      * may alternatively throw to signal an invalid operation.
      */
     void write16(uint32_t address, uint16_t value) override;
-private:            
-    std::vector<std::byte> romData_; ///< Internal buffer holding the ROM image.
+
+    /**
+     * @brief Read a byte from the ROM.
+     * @throws std::out_of_range if address is outside the loaded image.
+     */
+    uint8_t read8(uint32_t address) override;
+
+    /**
+     * @brief Read a 32-bit big-endian long from the ROM.
+     * @throws std::out_of_range if address+3 is outside the loaded image.
+     */
+    uint32_t read32(uint32_t address) override;
+
+    /** @brief ROM is read-only; byte writes are ignored. */
+    void write8(uint32_t address, uint8_t value) override;
+
+    /** @brief ROM is read-only; long writes are ignored. */
+    void write32(uint32_t address, uint32_t value) override;
+
+    /** @brief Whole ROM image, readable directly by the bus. */
+    std::span<const std::byte> readableMemory() override;
+
+    /** @brief True if the image is served from a file mapping rather than a copy. */
+    [[nodiscard]] bool isMemoryMapped() const { return mappedFile_.has_value(); }
+private:
+    void loadCopy(const char* filepath);
+    void convertToHostWords();
+
+    [[nodiscard]] uint16_t hostWord(uint32_t address) const { return hostWords_[(address >> 1U) & hostWordMask_]; }
+
+    std::optional<MappedFile> mappedFile_; ///< File mapping in MEMORY_MAP mode.
+    std::vector<std::byte> romData_;       ///< Internal buffer holding the ROM image in COPY mode.
+    std::span<const std::byte> image_;     ///< ROM image, points into mappedFile_ or romData_.
+    std::vector<uint16_t> hostWords_;      ///< Host-endian words in HOST_WORDS mode, power-of-two sized.
+    uint32_t hostWordMask_ = 0;            ///< hostWords_.size() - 1.
 };
 } // namespace DataExchange
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <span>
+
+/**
+ * @file mapped_file.h
+ * @brief Read-only, private memory mapping of a whole file.
+ *
+ * The file is mapped with MAP_PRIVATE and PROT_READ, so several processes mapping the
+ * same image share its page cache pages instead of each holding a private copy.
+ * On platforms without mmap() open() always returns std::nullopt.
+ */
+
+namespace DataExchange {
+
+class MappedFile {
+public:
+    /**
+     * @brief Map the whole file read-only.
+     * @param filepath Path to the file.
+     * @return The mapping, or std::nullopt if the file cannot be opened, is empty
+     *         or cannot be mapped.
+     */
+    [[nodiscard]] static std::optional<MappedFile> open(const char* filepath);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    /** @brief Mapped file contents. */
+    [[nodiscard]] std::span<const std::byte> data() const { return {data_, size_}; }
+
+private:
+    MappedFile(const std::byte* data, size_t size) : data_(data), size_(size) {}
+
+    void unmap() noexcept;
+
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace DataExchange
@@ -1,9 +1,30 @@
 #include "rom/filerom.h"
+#include <algorithm>
+#include <big_endian.h>
+#include <bit>
 #include <fstream>
 
 namespace DataExchange {
 
-FileROM::FileROM(const char* filepath)
+FileROM::FileROM(const char* filepath, ROMLoadMode mode)
+{
+    /// HOST_WORDS only needs the bytes during conversion, so a mapping avoids an extra copy
+    if (mode != ROMLoadMode::COPY) {
+        mappedFile_ = MappedFile::open(filepath);
+    }
+
+    if (mappedFile_.has_value()) {
+        image_ = mappedFile_->data();
+    } else {
+        loadCopy(filepath);
+    }
+
+    if (mode == ROMLoadMode::HOST_WORDS) {
+        convertToHostWords();
+    }
+}
+
+void FileROM::loadCopy(const char* filepath)
 {
     std::ifstream file(filepath, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
@@ -15,18 +36,47 @@ FileROM::FileROM(const char* filepath)
     romData_.resize(size);
 
     file.read(reinterpret_cast<char*>(romData_.data()), size); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    image_ = romData_;
+}
+
+void FileROM::convertToHostWords()
+{
+    constexpr auto openBusWord = static_cast<uint16_t>(0xFFFF);
+    const size_t wordsCount = std::bit_ceil(std::max<size_t>((image_.size() + 1) / 2, 1));
+
+    hostWords_.assign(wordsCount, openBusWord);
+    for (size_t i = 0; i + 1 < image_.size(); i += 2) {
+        hostWords_[i / 2] = loadBigEndian<uint16_t>(&image_[i]);
+    }
+
+    /// odd-sized image: the last byte is the high half of a padded word
+    if (image_.size() % 2 != 0) {
+        constexpr unsigned int shiftCount = 8;
+        hostWords_[image_.size() / 2] = static_cast<uint16_t>((std::to_integer<uint16_t>(image_.back()) << shiftCount) | 0xFFU); //NOLINT(*-magic-numbers)
+    }
+
+    hostWordMask_ = static_cast<uint32_t>(wordsCount - 1);
+
+    image_ = {};
+    mappedFile_.reset();
+    romData_.clear();
+    romData_.shrink_to_fit();
 }
 
 uint16_t FileROM::read16(uint32_t address)
 {
-    if (address + 1 >= romData_.size()) {
+    if (!hostWords_.empty()) {
+        return hostWord(address);
+    }
+
+    if (address + 1 >= image_.size()) {
         throw std::out_of_range("Попытка чтения за пределами ROM: " + std::to_string(address));
     }
 
     /// big-endian assembly
     constexpr unsigned int shiftCount = 8;
-    auto high = std::to_integer<uint32_t>(romData_[address]);
-    auto low  = std::to_integer<uint32_t>(romData_[address + 1]);
+    auto high = std::to_integer<uint32_t>(image_[address]);
+    auto low  = std::to_integer<uint32_t>(image_[address + 1]);
     return static_cast<uint16_t>((high << shiftCount) | low);
 }
 
@@ -36,6 +86,49 @@ void FileROM::write16(uint32_t /*address*/, uint16_t /*value*/)
     
 };
 
+uint8_t FileROM::read8(uint32_t address)
+{
+    if (!hostWords_.empty()) {
+        constexpr unsigned int shiftCount = 8;
+        return static_cast<uint8_t>((address & 1U) ? hostWord(address) : (hostWord(address) >> shiftCount));
+    }
+
+    if (address >= image_.size()) {
+        throw std::out_of_range("Попытка чтения за пределами ROM: " + std::to_string(address));
+    }
+
+    return std::to_integer<uint8_t>(image_[address]);
+}
+
+uint32_t FileROM::read32(uint32_t address)
+{
+    if (!hostWords_.empty()) {
+        constexpr unsigned int shiftCount = 16;
+        return (static_cast<uint32_t>(hostWord(address)) << shiftCount) | hostWord(address + 2);
+    }
+
+    if (static_cast<size_t>(address) + sizeof(uint32_t) > image_.size()) {
+        throw std::out_of_range("Попытка чтения за пределами ROM: " + std::to_string(address));
+    }
+
+    return loadBigEndian<uint32_t>(&image_[address]);
+}
+
+void FileROM::write8(uint32_t /*address*/, uint8_t /*value*/)
+{
+
+}
+
+void FileROM::write32(uint32_t /*address*/, uint32_t /*value*/)
+{
+
+}
+
+std::span<const std::byte> FileROM::readableMemory()
+{
+    return image_;
+}
+
 
 
 }  // namespace DataExchange
\ No newline at end of file
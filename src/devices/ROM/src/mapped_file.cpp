@@ -0,0 +1,78 @@
+#include "rom/mapped_file.h"
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ROM_HAS_MMAP 1
+#endif
+
+namespace DataExchange {
+
+std::optional<MappedFile> MappedFile::open(const char* filepath)
+{
+#if defined(ROM_HAS_MMAP)
+    const int fd = ::open(filepath, O_RDONLY | O_CLOEXEC); //NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    struct stat fileStat {};
+    if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ::close(fd);
+        return std::nullopt;
+    }
+
+    const auto size = static_cast<size_t>(fileStat.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    /// the mapping keeps its own reference to the file
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) { //NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        return std::nullopt;
+    }
+
+    return MappedFile(static_cast<const std::byte*>(mapping), size);
+#else
+    static_cast<void>(filepath);
+    return std::nullopt;
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+{
+
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+void MappedFile::unmap() noexcept
+{
+#if defined(ROM_HAS_MMAP)
+    if (data_ != nullptr) {
+        ::munmap(const_cast<std::byte*>(data_), size_); //NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace DataExchange
@@ -1,24 +1,39 @@
 #include <gtest/gtest.h>
 #include <filesystem>
 #include <fstream>
+#include <random>
 #include <rom/filerom.h>
+#include <span>
 
 namespace {
+
+/// Write data to a new file in the temp directory, named after the running test and a random suffix
+std::string writeTempFile(std::span<const std::byte> data) {
+    const auto* testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::random_device random;
+    const auto path = std::filesystem::temp_directory_path() /
+                      (std::string("filerom_") + testInfo->name() + "_" + std::to_string(random()) + ".bin");
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())); //NOLINT
+    if (!file) {
+        throw std::runtime_error("cannot write " + path.string());
+    }
+    return path.string();
+}
+
 class FileROMTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        tempFile_ = std::tmpnam(nullptr); //NOLINT
-        std::ofstream file(tempFile_, std::ios::binary);
-        file.write(reinterpret_cast<const char*>(romData_.data()), romData_.size()); //NOLINT
-        file.close();
+        tempFile_ = writeTempFile(romData_);
     }
 
     void TearDown() override {
         std::filesystem::remove(tempFile_);
     }
 
-    DataExchange::FileROM createROM() {
-        return DataExchange::FileROM(tempFile_.c_str());
+    DataExchange::FileROM createROM(DataExchange::ROMLoadMode mode = DataExchange::ROMLoadMode::MEMORY_MAP) {
+        return DataExchange::FileROM(tempFile_.c_str(), mode);
     }
 
     //NOLINTBEGIN
@@ -56,8 +71,7 @@ TEST_F(FileROMTest, ThrowsOnOutOfBoundsRead) {
 }
 
 TEST_F(FileROMTest, HandlesEmptyFile) {
-    std::string emptyFile = std::tmpnam(nullptr); //NOLINT
-    std::ofstream(emptyFile, std::ios::binary).close();
+    const std::string emptyFile = writeTempFile({});
     auto cleanup = [&]() { std::filesystem::remove(emptyFile); };
 
     EXPECT_THROW({
@@ -66,4 +80,59 @@ TEST_F(FileROMTest, HandlesEmptyFile) {
     }, std::out_of_range);
 
     cleanup();
+}
+TEST_F(FileROMTest, ExposesImageAsReadableMemory) {
+    auto rom = createROM();
+    const auto memory = rom.readableMemory();
+
+    ASSERT_EQ(memory.size(), romData_.size());
+    EXPECT_TRUE(std::equal(memory.begin(), memory.end(), romData_.begin()));
+    EXPECT_TRUE(rom.writableMemory().empty());
+}
+
+TEST_F(FileROMTest, MappedAndCopiedImagesMatch) {
+    auto mappedRom = createROM(DataExchange::ROMLoadMode::MEMORY_MAP);
+    auto copiedRom = createROM(DataExchange::ROMLoadMode::COPY);
+
+#if defined(__unix__) || defined(__APPLE__)
+    EXPECT_TRUE(mappedRom.isMemoryMapped());
+#endif
+    EXPECT_FALSE(copiedRom.isMemoryMapped());
+
+    const auto mapped = mappedRom.readableMemory();
+    const auto copied = copiedRom.readableMemory();
+    ASSERT_EQ(mapped.size(), copied.size());
+    EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), copied.begin()));
+    EXPECT_EQ(mappedRom.read32(4), 0x12345678); //NOLINT
+}
+
+TEST_F(FileROMTest, HostWordsModeMirrorsByMask) {
+    auto rom = createROM(DataExchange::ROMLoadMode::HOST_WORDS);
+
+    EXPECT_FALSE(rom.isMemoryMapped());
+    EXPECT_TRUE(rom.readableMemory().empty());
+
+    EXPECT_EQ(rom.read16(0), 0x5345); //NOLINT
+    EXPECT_EQ(rom.read16(7), 0x5678); //NOLINT
+    EXPECT_EQ(rom.read8(4), 0x12); //NOLINT
+    EXPECT_EQ(rom.read8(5), 0x34); //NOLINT
+    EXPECT_EQ(rom.read32(4), 0x12345678); //NOLINT
+
+    /// the 8-byte image mirrors every 8 bytes instead of throwing
+    EXPECT_EQ(rom.read16(8), 0x5345); //NOLINT
+    EXPECT_EQ(rom.read16(100), 0x1234); //NOLINT
+    EXPECT_EQ(rom.read32(6), 0x56785345); //NOLINT
+}
+
+TEST(ROMFileDeviceTest, HostWordsModePadsToPowerOfTwo) {
+    //NOLINTNEXTLINE
+    const std::array<std::byte, 5> oddData = {std::byte{0x12}, std::byte{0x34}, std::byte{0x56}, std::byte{0x78}, std::byte{0x9A}};
+    const std::string oddFile = writeTempFile(oddData);
+
+    DataExchange::FileROM rom(oddFile.c_str(), DataExchange::ROMLoadMode::HOST_WORDS);
+    std::filesystem::remove(oddFile);
+
+    EXPECT_EQ(rom.read16(4), 0x9AFF); //NOLINT
+    EXPECT_EQ(rom.read16(6), 0xFFFF); //NOLINT
+    EXPECT_EQ(rom.read16(8), 0x1234); //NOLINT
 }
\ No newline at end of file
@@ -1,7 +1,15 @@
 #include <bus/bus.h>
 #include <cpu/cpu.h>
+#include <cstdint>
+#include <ram/ram.h>
 #include <rom/filerom.h>
 
+namespace {
+
+/// NTSC Genesis: 68000 clocked at master clock / 7, 60 frames per second
+constexpr int64_t M68K_CYCLES_PER_FRAME = 53'693'175 / 7 / 60;
+
+} // namespace
 
 int main(int, char**){
 
@@ -20,11 +28,28 @@ int main(int, char**){
         throw std::runtime_error("Failed to map ROM device to bus.");
     }
 
+    auto workRam = std::make_shared<DataExchange::RAM>(0x10000); //NOLINT
+
+    mapResult = bus.mapDevice(DataExchange::DeviceParams{
+        .device = workRam,
+        .baseAddress = 0xFF0000,
+        .readRange = DataExchange::AddressRange{.start=0x0000, .end=0xFFFF}, //NOLINT
+        .writeRange = DataExchange::AddressRange{.start=0x0000, .end=0xFFFF} //NOLINT
+    });
+
+    if (!mapResult) {
+        throw std::runtime_error("Failed to map work RAM device to bus.");
+    }
+
     m68k::CPU cpu(std::make_shared<DataExchange::Bus>(bus));
-    cpu.reset();
+    if (!cpu.reset()) {
+        throw std::runtime_error("Failed to read the CPU reset vectors.");
+    }
 
     while (true) {
-        cpu.executeNextInstruction();
+        if (!cpu.run(M68K_CYCLES_PER_FRAME)) {
+            throw std::runtime_error("CPU stopped on an unimplemented instruction or a double bus fault.");
+        }
     }
 
     return 0;